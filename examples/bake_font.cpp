@@ -0,0 +1,74 @@
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @author      Eduardo Aguiar <aguiar@protonmail.ch>
+// @copyright   Copyright (c) 2025 Eduardo Aguiar
+//
+// This file is part of Allegro++.
+// 
+// Allegro++ is free software: you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+// 
+// You should have received a copy of the GNU Lesser General Public License
+// along with Allegro++. If not, see <https://www.gnu.org/licenses/>.
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+#include <allegropp/font.hpp>
+#include <cstdlib>
+#include <exception>
+#include <iostream>
+#include <string>
+#include <vector>
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Main function
+//!
+//! Usage: bake_font FONT OUTPUT.alppfont SIZE... [-c CHARSET]
+//!
+//! Bakes FONT at each SIZE into OUTPUT.alppfont and OUTPUT.alppfont.png,
+//! loaded afterwards with allegropp::font ("OUTPUT.alppfont", SIZE).
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+int
+main (int argc, char **argv)
+{
+  std::vector <std::string> args (argv + 1, argv + argc);
+  std::vector <std::size_t> sizes;
+  std::string charset;
+  bool is_valid = args.size () >= 3;
+
+  for (std::size_t i = 2; is_valid && i < args.size (); i++)
+    {
+      if (args[i] == "-c" && i + 1 < args.size ())
+        charset = args[++i];
+
+      else if (std::atoi (args[i].c_str ()) > 0)
+        sizes.push_back (std::size_t (std::atoi (args[i].c_str ())));
+
+      else
+        is_valid = false;
+    }
+
+  if (!is_valid || sizes.empty ())
+    {
+      std::cerr << "usage: bake_font FONT OUTPUT.alppfont SIZE... [-c CHARSET]" << std::endl;
+      return EXIT_FAILURE;
+    }
+
+  try
+    {
+      allegropp::bake_font (args[0], sizes, charset, args[1]);
+    }
+  catch (const std::exception& e)
+    {
+      std::cerr << "bake_font: " << e.what () << std::endl;
+      return EXIT_FAILURE;
+    }
+
+  std::cout << "baked " << sizes.size () << " size(s) into " << args[1] << std::endl;
+
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,274 @@
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @author      Eduardo Aguiar <aguiar@protonmail.ch>
+// @copyright   Copyright (c) 2025 Eduardo Aguiar
+//
+// This file is part of Allegro++.
+// 
+// Allegro++ is free software: you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+// 
+// You should have received a copy of the GNU Lesser General Public License
+// along with Allegro++. If not, see <https://www.gnu.org/licenses/>.
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+#include <allegropp/color.hpp>
+#include <allegropp/color_batch.hpp>
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <cstdio>
+#include <memory>
+#include <random>
+#include <vector>
+
+namespace
+{
+  constexpr int CALLS = 10000000;
+  constexpr int COLORS = 1 << 16;
+  constexpr int ROUNDS = 100;
+
+  // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+  //! \brief Previous color layout: ALLEGRO_COLOR behind a shared pointer
+  // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+  class shared_color
+  {
+  public:
+    shared_color (unsigned char r, unsigned char g, unsigned char b)
+      : impl_ (std::make_shared <ALLEGRO_COLOR> (ALLEGRO_COLOR {r / 255.0f, g / 255.0f, b / 255.0f, 1.0f}))
+    {
+    }
+
+    ALLEGRO_COLOR
+    get_implementation () const
+    {
+      return *impl_;
+    }
+
+  private:
+    std::shared_ptr <ALLEGRO_COLOR> impl_;
+  };
+
+  volatile float sink;
+
+  // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+  //! \brief Use a color, as font::draw_text_* and friends would
+  //! \param c Allegro color
+  // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+  void
+  use (const ALLEGRO_COLOR& c)
+  {
+    sink = c.r;
+  }
+
+  // Called through a volatile pointer, so it is never inlined away
+  void (*volatile use_ptr) (const ALLEGRO_COLOR&) = use;
+} // namespace
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Construct, copy and use colors, and print time per call
+//! \param name Benchmark name
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+template <typename Color>
+void
+run (const char *name)
+{
+  auto start = std::chrono::steady_clock::now ();
+
+  for (int i = 0; i < CALLS; i++)
+    {
+      Color c (i & 255, 60, 192);
+      Color copy = c;
+      use_ptr (copy.get_implementation ());
+    }
+
+  auto end = std::chrono::steady_clock::now ();
+  double ns = std::chrono::duration <double, std::nano> (end - start).count ();
+
+  std::printf ("  %-14s %8.2f ns/call\n", name, ns / CALLS);
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Get greatest difference between two float arrays
+//! \param a First array
+//! \param b Second array
+//! \param stride Components per color
+//! \param hue_index Index of hue component, compared modulo 360 (-1 for none)
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+float
+max_error (const std::vector <float>& a, const std::vector <float>& b, int stride, int hue_index = -1)
+{
+  float error = 0;
+
+  for (std::size_t i = 0; i < a.size (); i++)
+    {
+      float d = std::fabs (a[i] - b[i]);
+
+      if (int (i % stride) == hue_index)
+        d = std::min (d, 360 - d) / 360;
+
+      error = std::max (error, d);
+    }
+
+  return error;
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Check batch conversions against Allegro, color by color
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+void
+check_batch ()
+{
+  std::mt19937 rng (1);
+  std::uniform_real_distribution <float> unit (0, 1);
+  std::uniform_real_distribution <float> hue (0, 360);
+
+  std::vector <float> src (COLORS * 4);
+  std::vector <float> expected (COLORS * 4);
+  std::vector <float> got (COLORS * 4);
+  std::vector <ALLEGRO_COLOR> rgba (COLORS);
+
+  for (int i = 0; i < COLORS; i++)
+    {
+      src[i * 4] = unit (rng);
+      src[i * 4 + 1] = unit (rng);
+      src[i * 4 + 2] = unit (rng);
+      src[i * 4 + 3] = unit (rng);
+    }
+
+  // Spaces to RGB
+  auto to_floats = [&] ()
+  {
+    for (int i = 0; i < COLORS; i++)
+      {
+        got[i * 3] = rgba[i].r;
+        got[i * 3 + 1] = rgba[i].g;
+        got[i * 3 + 2] = rgba[i].b;
+      }
+
+    got.resize (COLORS * 3);
+    expected.resize (COLORS * 3);
+  };
+
+  std::vector <float> hsx (COLORS * 3);
+
+  for (int i = 0; i < COLORS; i++)
+    {
+      hsx[i * 3] = hue (rng);
+      hsx[i * 3 + 1] = unit (rng);
+      hsx[i * 3 + 2] = unit (rng);
+    }
+
+  allegropp::colors_from_hsv (hsx.data (), rgba.data (), COLORS);
+  to_floats ();
+  for (int i = 0; i < COLORS; i++)
+    al_color_hsv_to_rgb (hsx[i * 3], hsx[i * 3 + 1], hsx[i * 3 + 2], &expected[i * 3], &expected[i * 3 + 1], &expected[i * 3 + 2]);
+  std::printf ("  hsv  -> rgb    max error %g\n", max_error (expected, got, 3));
+
+  allegropp::colors_from_hsl (hsx.data (), rgba.data (), COLORS);
+  to_floats ();
+  for (int i = 0; i < COLORS; i++)
+    al_color_hsl_to_rgb (hsx[i * 3], hsx[i * 3 + 1], hsx[i * 3 + 2], &expected[i * 3], &expected[i * 3 + 1], &expected[i * 3 + 2]);
+  std::printf ("  hsl  -> rgb    max error %g\n", max_error (expected, got, 3));
+
+  allegropp::colors_from_yuv (src.data (), rgba.data (), COLORS);
+  to_floats ();
+  for (int i = 0; i < COLORS; i++)
+    al_color_yuv_to_rgb (src[i * 3], src[i * 3 + 1], src[i * 3 + 2], &expected[i * 3], &expected[i * 3 + 1], &expected[i * 3 + 2]);
+  std::printf ("  yuv  -> rgb    max error %g\n", max_error (expected, got, 3));
+
+  allegropp::colors_from_cmyk (src.data (), rgba.data (), COLORS);
+  to_floats ();
+  for (int i = 0; i < COLORS; i++)
+    al_color_cmyk_to_rgb (src[i * 4], src[i * 4 + 1], src[i * 4 + 2], src[i * 4 + 3], &expected[i * 3], &expected[i * 3 + 1], &expected[i * 3 + 2]);
+  std::printf ("  cmyk -> rgb    max error %g\n", max_error (expected, got, 3));
+
+  // RGB to spaces
+  for (int i = 0; i < COLORS; i++)
+    rgba[i] = al_map_rgb_f (src[i * 4], src[i * 4 + 1], src[i * 4 + 2]);
+
+  allegropp::colors_to_hsv (rgba.data (), got.data (), COLORS);
+  for (int i = 0; i < COLORS; i++)
+    al_color_rgb_to_hsv (rgba[i].r, rgba[i].g, rgba[i].b, &expected[i * 3], &expected[i * 3 + 1], &expected[i * 3 + 2]);
+  std::printf ("  rgb  -> hsv    max error %g\n", max_error (expected, got, 3, 0));
+
+  allegropp::colors_to_hsl (rgba.data (), got.data (), COLORS);
+  for (int i = 0; i < COLORS; i++)
+    al_color_rgb_to_hsl (rgba[i].r, rgba[i].g, rgba[i].b, &expected[i * 3], &expected[i * 3 + 1], &expected[i * 3 + 2]);
+  std::printf ("  rgb  -> hsl    max error %g\n", max_error (expected, got, 3, 0));
+
+  allegropp::colors_to_yuv (rgba.data (), got.data (), COLORS);
+  for (int i = 0; i < COLORS; i++)
+    al_color_rgb_to_yuv (rgba[i].r, rgba[i].g, rgba[i].b, &expected[i * 3], &expected[i * 3 + 1], &expected[i * 3 + 2]);
+  std::printf ("  rgb  -> yuv    max error %g\n", max_error (expected, got, 3));
+
+  got.resize (COLORS * 4);
+  expected.resize (COLORS * 4);
+
+  allegropp::colors_to_cmyk (rgba.data (), got.data (), COLORS);
+  for (int i = 0; i < COLORS; i++)
+    al_color_rgb_to_cmyk (rgba[i].r, rgba[i].g, rgba[i].b, &expected[i * 4], &expected[i * 4 + 1], &expected[i * 4 + 2], &expected[i * 4 + 3]);
+  std::printf ("  rgb  -> cmyk   max error %g\n", max_error (expected, got, 4));
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Time HSV to RGBA conversion, per color and in batch
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+void
+time_batch ()
+{
+  std::vector <float> hsv (COLORS * 3);
+  std::vector <ALLEGRO_COLOR> rgba (COLORS);
+
+  for (int i = 0; i < COLORS; i++)
+    {
+      hsv[i * 3] = i * 360.0f / COLORS;
+      hsv[i * 3 + 1] = 0.75f;
+      hsv[i * 3 + 2] = 0.9f;
+    }
+
+  auto start = std::chrono::steady_clock::now ();
+
+  for (int round = 0; round < ROUNDS; round++)
+    for (int i = 0; i < COLORS; i++)
+      rgba[i] = allegropp::new_color_by_hsv (hsv[i * 3], hsv[i * 3 + 1], hsv[i * 3 + 2]).get_implementation ();
+
+  auto middle = std::chrono::steady_clock::now ();
+
+  for (int round = 0; round < ROUNDS; round++)
+    allegropp::colors_from_hsv (hsv.data (), rgba.data (), COLORS);
+
+  auto end = std::chrono::steady_clock::now ();
+
+  double per_color = std::chrono::duration <double, std::nano> (middle - start).count ();
+  double batch = std::chrono::duration <double, std::nano> (end - middle).count ();
+
+  std::printf ("  %-14s %8.2f ns/color\n", "per color", per_color / (double (ROUNDS) * COLORS));
+  std::printf ("  %-14s %8.2f ns/color\n", "batch", batch / (double (ROUNDS) * COLORS));
+  use_ptr (rgba[COLORS / 2]);
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Main function
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+int
+main ()
+{
+  std::printf ("construct + copy + use, %d calls\n", CALLS);
+  run <shared_color> ("shared_ptr");
+  run <allegropp::color> ("color");
+
+  std::printf ("\nbatch conversions vs Allegro, %d colors\n", COLORS);
+  check_batch ();
+
+  std::printf ("\nHSV to RGBA, %d colors x %d\n", COLORS, ROUNDS);
+  time_batch ();
+
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,199 @@
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @author      Eduardo Aguiar <aguiar@protonmail.ch>
+// @copyright   Copyright (c) 2025 Eduardo Aguiar
+//
+// This file is part of Allegro++.
+// 
+// Allegro++ is free software: you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+// 
+// You should have received a copy of the GNU Lesser General Public License
+// along with Allegro++. If not, see <https://www.gnu.org/licenses/>.
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+#include <allegropp/dynamic_event_dispatcher.hpp>
+#include <allegropp/event_dispatcher.hpp>
+#include <chrono>
+#include <cstdlib>
+#include <cstdio>
+#include <random>
+#include <vector>
+
+namespace
+{
+  constexpr int EVENTS = 5000000;
+  constexpr int ROUNDS = 5;
+  constexpr unsigned int SEED = 42;
+
+  // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+  //! \brief Counters updated by the handlers, compared between dispatchers
+  // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+  struct game_state
+  {
+    long long mouse_dx = 0;
+    long long mouse_buttons = 0;
+    long long keys_down = 0;
+    long long keys_up = 0;
+    long long ticks = 0;
+    long long resizes = 0;
+    long long others = 0;
+
+    bool
+    operator== (const game_state& s) const
+    {
+      return mouse_dx == s.mouse_dx && mouse_buttons == s.mouse_buttons &&
+             keys_down == s.keys_down && keys_up == s.keys_up &&
+             ticks == s.ticks && resizes == s.resizes && others == s.others;
+    }
+
+    void on_key_up (const decltype (ALLEGRO_EVENT::keyboard)& event) { keys_up += event.keycode; }
+  };
+
+  // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+  //! \brief Make synthetic events, mostly mouse motion as in an input burst
+  //! \return Events
+  // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+  std::vector <ALLEGRO_EVENT>
+  make_events ()
+  {
+    std::mt19937 rng (SEED);
+    std::uniform_int_distribution <int> kind (0, 99);
+    std::uniform_int_distribution <int> value (-8, 8);
+    std::vector <ALLEGRO_EVENT> events (EVENTS);
+
+    for (auto& event : events)
+      {
+        const int k = kind (rng);
+
+        if (k < 70)
+          {
+            event.type = ALLEGRO_EVENT_MOUSE_AXES;
+            event.mouse.dx = value (rng);
+          }
+
+        else if (k < 76)
+          {
+            event.type = k % 2 ? ALLEGRO_EVENT_MOUSE_BUTTON_DOWN : ALLEGRO_EVENT_MOUSE_BUTTON_UP;
+            event.mouse.button = 1;
+          }
+
+        else if (k < 84)
+          {
+            event.type = k % 2 ? ALLEGRO_EVENT_KEY_DOWN : ALLEGRO_EVENT_KEY_UP;
+            event.keyboard.keycode = k;
+          }
+
+        else if (k < 94)
+          event.type = ALLEGRO_EVENT_TIMER;
+
+        else if (k < 95)
+          event.type = ALLEGRO_EVENT_DISPLAY_RESIZE;
+
+        else
+          event.type = ALLEGRO_EVENT_KEY_CHAR;
+      }
+
+    return events;
+  }
+
+  // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+  //! \brief Dispatch events and print time per event
+  //! \param name Dispatcher name
+  //! \param events Events
+  //! \param dispatch Function dispatching one event into a game_state
+  // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+  template <typename F>
+  void
+  run (const char *name, const std::vector <ALLEGRO_EVENT>& events, F dispatch)
+  {
+    auto start = std::chrono::steady_clock::now ();
+
+    for (int round = 0; round < ROUNDS; round++)
+      for (const auto& event : events)
+        dispatch (event);
+
+    auto end = std::chrono::steady_clock::now ();
+    double ns = std::chrono::duration <double, std::nano> (end - start).count ();
+
+    std::printf ("  %-26s %8.2f ns/event\n", name, ns / (double (ROUNDS) * events.size ()));
+  }
+
+} // namespace
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Main function
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+int
+main ()
+{
+  const auto events = make_events ();
+
+  std::printf ("dispatching %d synthetic events, %d rounds\n", EVENTS, ROUNDS);
+
+  // Hand-written switch
+  game_state switch_state;
+
+  run ("switch", events, [&](const ALLEGRO_EVENT& event) {
+    switch (event.type)
+      {
+        case ALLEGRO_EVENT_MOUSE_AXES: switch_state.mouse_dx += event.mouse.dx; break;
+        case ALLEGRO_EVENT_MOUSE_BUTTON_DOWN: switch_state.mouse_buttons += event.mouse.button; break;
+        case ALLEGRO_EVENT_MOUSE_BUTTON_UP: switch_state.mouse_buttons -= event.mouse.button; break;
+        case ALLEGRO_EVENT_KEY_DOWN: switch_state.keys_down += event.keyboard.keycode; break;
+        case ALLEGRO_EVENT_KEY_UP: switch_state.on_key_up (event.keyboard); break;
+        case ALLEGRO_EVENT_TIMER: switch_state.ticks++; break;
+        case ALLEGRO_EVENT_DISPLAY_RESIZE: switch_state.resizes++; break;
+        default: switch_state.others++; break;
+      }
+  });
+
+  // Compile-time handler table
+  game_state static_state;
+
+  allegropp::event_dispatcher static_dispatcher (
+    allegropp::on <ALLEGRO_EVENT_MOUSE_AXES> ([&](const auto& mouse) { static_state.mouse_dx += mouse.dx; }),
+    allegropp::on <ALLEGRO_EVENT_MOUSE_BUTTON_DOWN> ([&](const auto& mouse) { static_state.mouse_buttons += mouse.button; }),
+    allegropp::on <ALLEGRO_EVENT_MOUSE_BUTTON_UP> ([&](const auto& mouse) { static_state.mouse_buttons -= mouse.button; }),
+    allegropp::on <ALLEGRO_EVENT_KEY_DOWN> ([&](const auto& keyboard) { static_state.keys_down += keyboard.keycode; }),
+    allegropp::on <ALLEGRO_EVENT_KEY_UP> (&game_state::on_key_up, &static_state),
+    allegropp::on <ALLEGRO_EVENT_TIMER> ([&](const auto&) { static_state.ticks++; }),
+    allegropp::on <ALLEGRO_EVENT_DISPLAY_RESIZE> ([&](const auto&) { static_state.resizes++; }));
+
+  run ("event_dispatcher", events, [&](const ALLEGRO_EVENT& event) {
+    if (!static_dispatcher.dispatch (event))
+      static_state.others++;
+  });
+
+  // Run-time registration
+  game_state dynamic_state;
+  allegropp::dynamic_event_dispatcher dynamic_dispatcher;
+
+  dynamic_dispatcher.add_handler <ALLEGRO_EVENT_MOUSE_AXES> ([&](const auto& mouse) { dynamic_state.mouse_dx += mouse.dx; });
+  dynamic_dispatcher.add_handler <ALLEGRO_EVENT_MOUSE_BUTTON_DOWN> ([&](const auto& mouse) { dynamic_state.mouse_buttons += mouse.button; });
+  dynamic_dispatcher.add_handler <ALLEGRO_EVENT_MOUSE_BUTTON_UP> ([&](const auto& mouse) { dynamic_state.mouse_buttons -= mouse.button; });
+  dynamic_dispatcher.add_handler <ALLEGRO_EVENT_KEY_DOWN> ([&](const auto& keyboard) { dynamic_state.keys_down += keyboard.keycode; });
+  dynamic_dispatcher.add_handler <ALLEGRO_EVENT_KEY_UP> ([&](const auto& keyboard) { dynamic_state.on_key_up (keyboard); });
+  dynamic_dispatcher.add_handler <ALLEGRO_EVENT_TIMER> ([&](const auto&) { dynamic_state.ticks++; });
+  dynamic_dispatcher.add_handler <ALLEGRO_EVENT_DISPLAY_RESIZE> ([&](const auto&) { dynamic_state.resizes++; });
+
+  run ("dynamic_event_dispatcher", events, [&](const ALLEGRO_EVENT& event) {
+    if (!dynamic_dispatcher.dispatch (event))
+      dynamic_state.others++;
+  });
+
+  if (!(static_state == switch_state) || !(dynamic_state == switch_state))
+    {
+      std::printf ("dispatchers disagree with the switch\n");
+      return EXIT_FAILURE;
+    }
+
+  std::printf ("all dispatchers agree with the switch\n");
+
+  return EXIT_SUCCESS;
+}
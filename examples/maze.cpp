@@ -21,7 +21,7 @@
 #include <allegropp/display.hpp>
 #include <allegropp/event_queue.hpp>
 #include <allegropp/maze.hpp>
-#include <allegro5/allegro_primitives.h>
+#include <allegropp/maze_renderer.hpp>
 #include <iostream>
 
 namespace
@@ -36,29 +36,15 @@ namespace
 
 // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
 //! \brief Draw example
-//! \param maze Maze object
+//! \param renderer Maze renderer
 // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
 void
-draw (allegropp::maze& maze)
+draw (allegropp::maze_renderer& renderer)
 {
-  allegropp::color brick_color (0, 60, 192);
   allegropp::color bg_color (0, 0, 0);
   al_clear_to_color (bg_color.get_implementation ());
-  
-  for (int y = 0;y < maze.get_height ();y++)
-    {
-      for (int x = 0;x < maze.get_width ();x++)
-        {
-            if (maze.get (x, y) == allegropp::maze::WALL)
-              al_draw_filled_rectangle (
-                   x * CELL_WIDTH + SCREEN_BORDER,
-                   y * CELL_HEIGHT + SCREEN_BORDER,
-                   x * CELL_WIDTH + CELL_WIDTH - 2 + SCREEN_BORDER,
-                   y * CELL_HEIGHT + CELL_HEIGHT - 2 + SCREEN_BORDER,
-                   brick_color.get_implementation ()
-              );
-        }
-    }
+
+  renderer.draw (SCREEN_BORDER, SCREEN_BORDER, 0, 0, SCREEN_WIDTH, SCREEN_HEIGHT);
 }
 
 // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
@@ -80,6 +66,10 @@ main ()
 
   // Create maze
   allegropp::maze maze (25, 27);
+  allegropp::maze_renderer renderer (maze, CELL_WIDTH, CELL_HEIGHT);
+
+  renderer.set_color (allegropp::maze::WALL, allegropp::color (0, 60, 192));
+  renderer.set_gap (2);
 
   // Main game loop
   allegropp::event_queue event_queue;
@@ -97,7 +87,7 @@ main ()
 
       else
         {
-          draw (maze);
+          draw (renderer);
           display.flip ();
           al_rest (1.0);
         }
@@ -0,0 +1,123 @@
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @author      Eduardo Aguiar <aguiar@protonmail.ch>
+// @copyright   Copyright (c) 2025 Eduardo Aguiar
+//
+// This file is part of Allegro++.
+// 
+// Allegro++ is free software: you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+// 
+// You should have received a copy of the GNU Lesser General Public License
+// along with Allegro++. If not, see <https://www.gnu.org/licenses/>.
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+#include <allegropp/maze.hpp>
+#include <allegropp/maze_pathfinder.hpp>
+#include <chrono>
+#include <cstdlib>
+#include <cstdio>
+#include <random>
+#include <utility>
+#include <vector>
+
+namespace
+{
+  constexpr int QUERIES = 2000;
+  constexpr unsigned int SEED = 42;
+  constexpr int SIZES[] = {101, 301, 1001};
+} // namespace
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Pick random passage cells as query endpoints
+//! \param maze Maze object
+//! \param count Number of points
+//! \return Points
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+std::vector <std::pair <int, int>>
+random_points (const allegropp::maze& maze, int count)
+{
+  std::mt19937 rng (SEED);
+  std::uniform_int_distribution <int> dist_x (0, maze.get_width () - 1);
+  std::uniform_int_distribution <int> dist_y (0, maze.get_height () - 1);
+  std::vector <std::pair <int, int>> points;
+
+  while (int (points.size ()) < count)
+    {
+      int x = dist_x (rng);
+      int y = dist_y (rng);
+
+      if (maze.get (x, y) == allegropp::maze::PASSAGE)
+        points.emplace_back (x, y);
+    }
+
+  return points;
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Run queries and print timing
+//! \param name Algorithm name
+//! \param pathfinder Pathfinder object
+//! \param points Query endpoints, taken in pairs
+//! \param query Function running one query, returning path length
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+template <typename F>
+void
+run (const char *name, allegropp::maze_pathfinder& pathfinder, const std::vector <std::pair <int, int>>& points, F query)
+{
+  long long total_length = 0;
+  std::size_t total_expanded = 0;
+
+  auto start = std::chrono::steady_clock::now ();
+
+  for (std::size_t i = 0; i + 1 < points.size (); i += 2)
+    {
+      total_length += query (points[i], points[i + 1]);
+      total_expanded += pathfinder.get_expanded_nodes ();
+    }
+
+  auto end = std::chrono::steady_clock::now ();
+  double us = std::chrono::duration <double, std::micro> (end - start).count ();
+  std::size_t queries = points.size () / 2;
+
+  std::printf ("  %-10s %10.1f us/query %12zu expanded/query  (total length %lld)\n",
+               name, us / queries, total_expanded / queries, total_length);
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Main function
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+int
+main ()
+{
+  for (int size : SIZES)
+    {
+      allegropp::maze maze (size, size, SEED);
+      allegropp::maze_pathfinder pathfinder (maze);
+      allegropp::maze_pathfinder::path_type path;
+      auto points = random_points (maze, QUERIES * 2);
+
+      std::printf ("maze %dx%d, %d queries\n", maze.get_width (), maze.get_height (), QUERIES);
+
+      run ("BFS", pathfinder, points, [&](auto a, auto b) {
+        return pathfinder.get_bfs_distance (a.first, a.second, b.first, b.second);
+      });
+
+      run ("A*", pathfinder, points, [&](auto a, auto b) {
+        pathfinder.find_path_astar (a.first, a.second, b.first, b.second, path);
+        return int (path.size ()) - 1;
+      });
+
+      run ("JPS", pathfinder, points, [&](auto a, auto b) {
+        pathfinder.find_path_jps (a.first, a.second, b.first, b.second, path);
+        return int (path.size ()) - 1;
+      });
+    }
+
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,185 @@
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @author      Eduardo Aguiar <aguiar@protonmail.ch>
+// @copyright   Copyright (c) 2025 Eduardo Aguiar
+//
+// This file is part of Allegro++.
+// 
+// Allegro++ is free software: you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+// 
+// You should have received a copy of the GNU Lesser General Public License
+// along with Allegro++. If not, see <https://www.gnu.org/licenses/>.
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+#include <allegropp/atlas.hpp>
+#include <allegropp/bitmap_lock.hpp>
+#include <allegropp/color.hpp>
+#include <allegropp/display.hpp>
+#include <allegropp/event_queue.hpp>
+#include <allegropp/sprite_batch.hpp>
+#include <allegropp/timer.hpp>
+#include <cmath>
+#include <iostream>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace
+{
+  constexpr int SCREEN_WIDTH = 800;
+  constexpr int SCREEN_HEIGHT = 600;
+  constexpr int IMAGE_COUNT = 64;
+  constexpr int SPRITE_COUNT = 5000;
+  constexpr int LAYER_COUNT = 3;
+  constexpr int REPORT_FRAMES = 60;
+
+  //! \brief Moving sprite
+  struct actor
+  {
+    allegropp::sprite image;
+    float x, y;
+    float dx, dy;
+    float angle, spin;
+    float scale;
+    allegropp::color tint;
+    int layer;
+  };
+} // namespace
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Create image: a framed square of random size and color
+//! \param rng Random number generator
+//! \return Bitmap
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+allegropp::bitmap
+create_image (std::mt19937& rng)
+{
+  std::uniform_int_distribution <int> size (8, 48);
+  const int width = size (rng);
+  const int height = size (rng);
+
+  const int flags = al_get_new_bitmap_flags ();
+  al_set_new_bitmap_flags (ALLEGRO_MEMORY_BITMAP);
+  allegropp::bitmap b (width, height);
+  al_set_new_bitmap_flags (flags);
+
+  auto lock = b.lock (ALLEGRO_PIXEL_FORMAT_ABGR_8888_LE, allegropp::bitmap::WRITE_ONLY);
+  auto pixels = lock.get_span <std::uint32_t> ();
+  const std::uint32_t fill = 0xff000000 | (rng () & 0x00ffffff);
+
+  for (int y = 0; y < height; y++)
+    for (int x = 0; x < width; x++)
+      pixels (x, y) = (x == 0 || y == 0 || x == width - 1 || y == height - 1) ? 0xffffffff : fill;
+
+  return b;
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Main function
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+int
+main ()
+{
+  // Create display
+  auto display = allegropp::display (SCREEN_WIDTH, SCREEN_HEIGHT);
+
+  if (!display)
+    {
+      std::cerr << "Failed to create display!" << std::endl;
+      return EXIT_FAILURE;
+    }
+
+  display.set_window_title ("Allegro++ Sprites Example");
+
+  // Pack images into an atlas
+  std::mt19937 rng (42);
+  allegropp::atlas atlas (512, 512, 1, 1, std::max (1u, std::thread::hardware_concurrency ()));
+
+  for (int i = 0; i < IMAGE_COUNT; i++)
+    atlas.add ("image" + std::to_string (i), create_image (rng));
+
+  atlas.build ();
+  std::cout << IMAGE_COUNT << " images packed into " << atlas.get_page_count () << " page(s)" << std::endl;
+
+  // Create actors
+  std::uniform_real_distribution <float> unit (0.0f, 1.0f);
+  std::vector <actor> actors;
+
+  for (int i = 0; i < SPRITE_COUNT; i++)
+    {
+      actor a;
+      a.image = atlas.get_sprite ("image" + std::to_string (rng () % IMAGE_COUNT));
+      a.x = unit (rng) * SCREEN_WIDTH;
+      a.y = unit (rng) * SCREEN_HEIGHT;
+      a.dx = unit (rng) * 4 - 2;
+      a.dy = unit (rng) * 4 - 2;
+      a.angle = 0;
+      a.spin = unit (rng) * 0.1f - 0.05f;
+      a.scale = 0.5f + unit (rng);
+      a.tint = allegropp::color (255, 255, 255, 128 + rng () % 128);
+      a.layer = int (rng () % LAYER_COUNT);
+      actors.push_back (a);
+    }
+
+  // Main game loop
+  allegropp::timer timer (1.0 / 60);
+  allegropp::event_queue event_queue;
+
+  event_queue.add_display_events (display);
+  event_queue.add_timer_events (timer);
+  timer.start ();
+
+  allegropp::sprite_batch::statistics total;
+  int frames = 0;
+  bool running = true;
+
+  while (running)
+    {
+      ALLEGRO_EVENT event;
+      event_queue.get_event (event);
+
+      if (event.type == ALLEGRO_EVENT_DISPLAY_CLOSE)
+        running = false;
+
+      else if (event.type == ALLEGRO_EVENT_TIMER)
+        {
+          al_clear_to_color (allegropp::color (0, 0, 0).get_implementation ());
+
+          allegropp::sprite_batch batch (allegropp::sprite_batch::SORTED, actors.size ());
+
+          for (auto& a : actors)
+            {
+              a.x = std::fmod (a.x + a.dx + SCREEN_WIDTH, float (SCREEN_WIDTH));
+              a.y = std::fmod (a.y + a.dy + SCREEN_HEIGHT, float (SCREEN_HEIGHT));
+              a.angle += a.spin;
+              batch.draw (a.image, a.x, a.y, a.tint, a.angle, a.scale, a.scale, a.layer);
+            }
+
+          const auto stats = batch.end ();
+          display.flip ();
+
+          // Report batching efficiency
+          total.sprites += stats.sprites;
+          total.draw_calls += stats.draw_calls;
+          total.texture_switches += stats.texture_switches;
+
+          if (++frames == REPORT_FRAMES)
+            {
+              std::cout << total.sprites / frames << " sprites, "
+                        << total.draw_calls / frames << " draw calls, "
+                        << total.texture_switches / frames << " texture switches per frame" << std::endl;
+              total = {};
+              frames = 0;
+            }
+        }
+    }
+
+  return EXIT_SUCCESS;
+}
@@ -24,6 +24,7 @@ namespace allegropp
 {
 
 void init ();
+void init_image ();
 
 } // namespace allegropp
 
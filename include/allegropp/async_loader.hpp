@@ -0,0 +1,156 @@
+#ifndef ALLEGROPP_ASYNC_LOADER
+#define ALLEGROPP_ASYNC_LOADER
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @author      Eduardo Aguiar <aguiar@protonmail.ch>
+// @copyright   Copyright (c) 2025 Eduardo Aguiar
+//
+// This file is part of Allegro++.
+// 
+// Allegro++ is free software: you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+// 
+// You should have received a copy of the GNU Lesser General Public License
+// along with Allegro++. If not, see <https://www.gnu.org/licenses/>.
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+#include <allegropp/bitmap.hpp>
+#include <allegropp/font.hpp>
+#include <allegropp/sample.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <string>
+
+namespace allegropp
+{
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Asynchronous bitmap, font and sample loader
+//! \author Eduardo Aguiar
+//!
+//! Files are decoded on a pool of worker threads, highest priority first.
+//! Bitmaps are decoded into memory bitmaps, since video bitmaps belong to
+//! the thread owning the display; finalize, called on that thread (usually
+//! once per frame), converts them to video bitmaps. Bitmap fonts are
+//! loaded by finalize, as their glyph bitmaps cannot be reached to convert
+//! them. TTF fonts and samples need no finalization.
+//!
+//! Load functions return handles. handle::get waits for the resource and,
+//! if it is decoded but not finalized yet, finalizes it on the calling
+//! thread, so it must also be called on the display thread.
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+class async_loader
+{
+public:
+  // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+  // Datatypes
+  // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+  enum status : std::uint8_t
+  {
+    QUEUED = 0,         //!< Waiting for a worker
+    DECODING,           //!< Being decoded by a worker
+    DECODED,            //!< Decoded, waiting for finalize
+    READY,              //!< Ready to use
+    FAILED              //!< Failed to load, or cancelled
+  };
+
+  //! \brief Loader progress, counting all requests so far
+  struct progress
+  {
+    std::size_t requested = 0;          //!< Load requests
+    std::size_t decoded = 0;            //!< Requests waiting for finalize
+    std::size_t finished = 0;           //!< Requests ready or failed
+    std::size_t failed = 0;             //!< Requests failed
+
+    //! \brief Get fraction of requests finished (0..1)
+    float
+    get_fraction () const noexcept
+    {
+      return requested ? float (finished) / float (requested) : 1.0f;
+    }
+  };
+
+  class task;
+
+  // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+  //! \brief Load request handle, independent of the resource type
+  // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+  class handle_base
+  {
+  public:
+    status get_status () const;
+    bool is_done () const;
+    int get_priority () const;
+    const std::string& get_path () const;
+    void wait () const;
+    explicit operator bool () const noexcept;
+
+  protected:
+    handle_base () = default;
+    explicit handle_base (const std::shared_ptr <task>&);
+
+    std::shared_ptr <task> task_;     //!< Load request
+  };
+
+  // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+  //! \brief Load request handle
+  //!
+  //! get waits for the resource and returns it, or rethrows the load error.
+  // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+  template <typename T>
+  class handle : public handle_base
+  {
+  public:
+    handle () = default;
+    explicit handle (const std::shared_ptr <task>& t) : handle_base (t) { }
+    T get () const;
+  };
+
+  // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+  // Constructors
+  // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+  explicit async_loader (unsigned int = 1);
+  async_loader (async_loader&&) noexcept = default;
+  async_loader (const async_loader&) noexcept = default;
+
+  // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+  // Operators
+  // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+  async_loader& operator= (const async_loader&) noexcept = default;
+  async_loader& operator= (async_loader&&) noexcept = default;
+
+  // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+  // Function prototypes
+  // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+  handle <bitmap> load_bitmap (const std::string&, int = 0);
+  handle <font> load_font (const std::string&, std::size_t, int = 0);
+  handle <sample> load_sample (const std::string&, int = 0);
+  std::size_t finalize (std::size_t = std::numeric_limits <std::size_t>::max ());
+  void cancel ();
+  progress get_progress () const;
+
+private:
+  //! \brief Implementation class forward declaration
+  class impl;
+
+  //! \brief Implementation pointer
+  std::shared_ptr <impl> impl_;
+};
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// Function prototypes
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+template <> bitmap async_loader::handle <bitmap>::get () const;
+template <> font async_loader::handle <font>::get () const;
+template <> sample async_loader::handle <sample>::get () const;
+
+} // namespace allegropp
+
+#endif
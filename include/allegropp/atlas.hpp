@@ -0,0 +1,131 @@
+#ifndef ALLEGROPP_ATLAS
+#define ALLEGROPP_ATLAS
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @author      Eduardo Aguiar <aguiar@protonmail.ch>
+// @copyright   Copyright (c) 2025 Eduardo Aguiar
+//
+// This file is part of Allegro++.
+// 
+// Allegro++ is free software: you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+// 
+// You should have received a copy of the GNU Lesser General Public License
+// along with Allegro++. If not, see <https://www.gnu.org/licenses/>.
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+#include <allegropp/bitmap.hpp>
+#include <cstddef>
+#include <memory>
+#include <string>
+
+namespace allegropp
+{
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Sprite, a rectangle of an atlas page
+//! \author Eduardo Aguiar
+//!
+//! Sprites are cheap handles: they share the page bitmap, and draw through a
+//! sub-bitmap of it, so consecutive sprites of the same page do not switch
+//! textures.
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+class sprite
+{
+public:
+  // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+  // Constructors
+  // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+  sprite () = default;
+  sprite (const bitmap&, int, int, int, int);
+  sprite (sprite&&) noexcept = default;
+  sprite (const sprite&) = default;
+
+  // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+  // Operators
+  // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+  sprite& operator= (const sprite&) = default;
+  sprite& operator= (sprite&&) noexcept = default;
+
+  // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+  // Function prototypes
+  // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+  int get_x () const noexcept;
+  int get_y () const noexcept;
+  int get_width () const noexcept;
+  int get_height () const noexcept;
+  const bitmap& get_page () const noexcept;
+  const bitmap& get_bitmap () const noexcept;
+  void draw (float, float, int = 0) const;
+  void draw_scaled (float, float, float, float, int = 0) const;
+
+private:
+  bitmap page_;         //!< Atlas page
+  bitmap bitmap_;       //!< Sub-bitmap of the page
+  int x_ = 0;           //!< Left column on page
+  int y_ = 0;           //!< Top row on page
+  int width_ = 0;       //!< Width in pixels
+  int height_ = 0;      //!< Height in pixels
+};
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Texture atlas builder
+//! \author Eduardo Aguiar
+//!
+//! Images are added by name, either as files or as bitmaps, and build packs
+//! them into as few pages as possible, with a skyline bottom-left packer.
+//! Each image is surrounded by its edge pixels repeated <i>extrude</i> times,
+//! so linear filtering does not bleed neighbours in, plus <i>padding</i>
+//! transparent pixels. Files are decoded and pages composed by worker
+//! threads; only the final page upload runs on the calling thread.
+//!
+//! A built atlas can be saved, and loaded back on later runs. Loading fails
+//! (returns false) when the inputs or options changed since the save, so the
+//! usual pattern is: add images; if (!load (path)) { build (); save (path); }
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+class atlas
+{
+public:
+  // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+  // Constructors
+  // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+  explicit atlas (int = 2048, int = 2048, int = 1, int = 1, unsigned int = 1);
+  atlas (atlas&&) noexcept = default;
+  atlas (const atlas&) = default;
+
+  // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+  // Operators
+  // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+  atlas& operator= (const atlas&) = default;
+  atlas& operator= (atlas&&) noexcept = default;
+
+  // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+  // Function prototypes
+  // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+  void add (const std::string&, const std::string&);
+  void add (const std::string&, const bitmap&);
+  void build ();
+  bool load (const std::string&);
+  void save (const std::string&) const;
+  bool has_sprite (const std::string&) const;
+  sprite get_sprite (const std::string&) const;
+  std::size_t get_sprite_count () const;
+  std::size_t get_page_count () const;
+  bitmap get_page (std::size_t) const;
+
+private:
+  //! \brief Implementation class forward declaration
+  class impl;
+
+  //! \brief Implementation pointer
+  std::shared_ptr <impl> impl_;
+};
+
+} // namespace allegropp
+
+#endif
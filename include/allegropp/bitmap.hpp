@@ -26,6 +26,8 @@
 
 namespace allegropp
 {
+class bitmap_lock;
+
 // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
 //! \brief Allegro bitmap class
 //! \author Eduardo Aguiar
@@ -39,7 +41,19 @@ private:
   //! \brief Implementation pointer
   std::shared_ptr <impl> impl_;
 
+  friend class resource_cache;
+
 public:
+  // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+  // Datatypes
+  // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+  enum lock_mode : int
+  {
+    READ_WRITE = ALLEGRO_LOCK_READWRITE,
+    READ_ONLY = ALLEGRO_LOCK_READONLY,      //!< No upload on unlock
+    WRITE_ONLY = ALLEGRO_LOCK_WRITEONLY     //!< No readback on lock
+  };
+
   // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
   // Constructors
   // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
@@ -65,6 +79,11 @@ public:
   void draw (int, int, int = 0);
   void draw_scaled (int, int, int, int, int, int, int, int, int = 0);
   bitmap clone () const;
+  bitmap create_sub_bitmap (int, int, int, int) const;
+  void save (const std::string&) const;
+  ALLEGRO_BITMAP *get_implementation () const;
+  bitmap_lock lock (int = ALLEGRO_PIXEL_FORMAT_ANY, lock_mode = READ_WRITE) const;
+  bitmap_lock lock (int, int, int, int, int = ALLEGRO_PIXEL_FORMAT_ANY, lock_mode = READ_WRITE) const;
 };
 
 } // namespace allegropp
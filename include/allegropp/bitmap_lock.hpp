@@ -0,0 +1,228 @@
+#ifndef ALLEGROPP_BITMAP_LOCK
+#define ALLEGROPP_BITMAP_LOCK
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @author      Eduardo Aguiar <aguiar@protonmail.ch>
+// @copyright   Copyright (c) 2025 Eduardo Aguiar
+//
+// This file is part of Allegro++.
+// 
+// Allegro++ is free software: you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+// 
+// You should have received a copy of the GNU Lesser General Public License
+// along with Allegro++. If not, see <https://www.gnu.org/licenses/>.
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+#include <allegropp/bitmap.hpp>
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+
+namespace allegropp
+{
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Typed, row-strided 2D view over pixel memory
+//! \author Eduardo Aguiar
+//!
+//! span[y] is a pointer to row y and span (x, y) the pixel at x, y. The
+//! pitch is in bytes and may be negative, as Allegro returns for bitmaps
+//! stored bottom-up.
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+template <typename T>
+class pixel_span
+{
+public:
+  using byte_type = std::conditional_t <std::is_const_v <T>, const std::uint8_t, std::uint8_t>;
+
+  // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+  // Constructors
+  // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+  pixel_span () noexcept = default;
+
+  pixel_span (T *data, int width, int height, int pitch) noexcept
+    : data_ (reinterpret_cast <byte_type *> (data)), width_ (width), height_ (height), pitch_ (pitch)
+  {
+  }
+
+  //! \brief Conversion from a span of non-const pixels
+  template <typename U, typename = std::enable_if_t <std::is_same_v <const U, T>>>
+  pixel_span (const pixel_span <U>& other) noexcept
+    : pixel_span (other.get_data (), other.get_width (), other.get_height (), other.get_pitch ())
+  {
+  }
+
+  // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+  // Operators
+  // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+  T *
+  operator[] (int y) const noexcept
+  {
+    return reinterpret_cast <T *> (data_ + std::ptrdiff_t (y) * pitch_);
+  }
+
+  T&
+  operator() (int x, int y) const noexcept
+  {
+    return (*this)[y][x];
+  }
+
+  // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+  // Functions
+  // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+  T *get_data () const noexcept { return reinterpret_cast <T *> (data_); }
+  int get_width () const noexcept { return width_; }
+  int get_height () const noexcept { return height_; }
+  int get_pitch () const noexcept { return pitch_; }
+
+  //! \brief Check whether rows follow each other without gaps, top-down
+  bool
+  is_contiguous () const noexcept
+  {
+    return pitch_ == int (width_ * sizeof (T)) || height_ <= 1;
+  }
+
+  // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+  //! \brief Get a rectangle of this span
+  //! \param x Left column
+  //! \param y Top row
+  //! \param width Width in pixels
+  //! \param height Height in pixels
+  //! \return Span, clipped to this one
+  // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+  pixel_span
+  subspan (int x, int y, int width, int height) const noexcept
+  {
+    x = std::clamp (x, 0, width_);
+    y = std::clamp (y, 0, height_);
+    width = std::clamp (width, 0, width_ - x);
+    height = std::clamp (height, 0, height_ - y);
+
+    return pixel_span ((*this)[y] + x, width, height, pitch_);
+  }
+
+private:
+  byte_type *data_ = nullptr;   //!< First row
+  int width_ = 0;               //!< Width in pixels
+  int height_ = 0;              //!< Height in rows
+  int pitch_ = 0;               //!< Bytes from a row to the next one
+};
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Locked bitmap region (RAII)
+//! \author Eduardo Aguiar
+//!
+//! Created by bitmap::lock, and unlocked on destruction. READ_ONLY locks
+//! skip the upload on unlock and WRITE_ONLY locks skip the readback on lock,
+//! so video bitmaps are only transferred in the direction needed. Locking
+//! with a specific format makes Allegro convert the pixels, if needed.
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+class bitmap_lock
+{
+public:
+  // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+  // Constructors and destructor
+  // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+  bitmap_lock (const bitmap&, int, int, int, int, int, bitmap::lock_mode);
+  bitmap_lock (bitmap_lock&&) noexcept;
+  bitmap_lock (const bitmap_lock&) = delete;
+  ~bitmap_lock ();
+
+  // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+  // Operators
+  // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+  bitmap_lock& operator= (bitmap_lock&&) noexcept;
+  bitmap_lock& operator= (const bitmap_lock&) = delete;
+
+  // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+  // Function prototypes
+  // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+  int get_width () const noexcept;
+  int get_height () const noexcept;
+  int get_format () const noexcept;
+  int get_pixel_size () const noexcept;
+  bitmap::lock_mode get_mode () const noexcept;
+  void unlock ();
+
+  // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+  //! \brief Get typed view over the locked pixels
+  //! \return Span of T, whose size must match the pixel size
+  //!
+  //! Read-only locks only hand out spans of const pixels.
+  // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+  template <typename T>
+  pixel_span <T>
+  get_span () const
+  {
+    check_span (sizeof (T), std::is_const_v <T>);
+    return pixel_span <T> (static_cast <T *> (region_->data), width_, height_, region_->pitch);
+  }
+
+private:
+  void check_span (std::size_t, bool) const;
+
+  bitmap bitmap_;                               //!< Locked bitmap
+  ALLEGRO_LOCKED_REGION *region_ = nullptr;     //!< Locked region
+  int width_ = 0;                               //!< Region width
+  int height_ = 0;                              //!< Region height
+  bitmap::lock_mode mode_ = bitmap::READ_WRITE; //!< Lock mode
+};
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Fill span with a pixel value
+//! \param dst Destination span
+//! \param value Pixel value
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+template <typename T>
+void
+fill (const pixel_span <T>& dst, const T& value)
+{
+  if (dst.is_contiguous ())
+    std::fill_n (dst.get_data (), std::size_t (dst.get_width ()) * dst.get_height (), value);
+
+  else
+    for (int y = 0; y < dst.get_height (); y++)
+      std::fill_n (dst[y], dst.get_width (), value);
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Copy pixels between spans of the same pixel type
+//! \param src Source span
+//! \param dst Destination span
+//!
+//! The top-left rectangle common to both spans is copied, row by row.
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+template <typename T, typename U>
+void
+copy (const pixel_span <T>& src, const pixel_span <U>& dst)
+{
+  static_assert (std::is_same_v <std::remove_const_t <T>, U>, "copy needs spans of the same pixel type");
+  static_assert (std::is_trivially_copyable_v <U>, "copy needs trivially copyable pixels");
+
+  const int width = std::min (src.get_width (), dst.get_width ());
+  const int height = std::min (src.get_height (), dst.get_height ());
+
+  if (width == src.get_width () && width == dst.get_width () && src.is_contiguous () && dst.is_contiguous ())
+    std::memcpy (dst.get_data (), src.get_data (), std::size_t (width) * height * sizeof (U));
+
+  else
+    for (int y = 0; y < height; y++)
+      std::memcpy (dst[y], src[y], std::size_t (width) * sizeof (U));
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// Function prototypes
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+void convert (const pixel_span <const std::uint32_t>&, int, const pixel_span <std::uint32_t>&, int);
+
+} // namespace allegropp
+
+#endif
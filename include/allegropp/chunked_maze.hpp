@@ -0,0 +1,70 @@
+#ifndef ALLEGROPP_CHUNKED_MAZE
+#define ALLEGROPP_CHUNKED_MAZE
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @author      Eduardo Aguiar <aguiar@protonmail.ch>
+// @copyright   Copyright (c) 2025 Eduardo Aguiar
+//
+// This file is part of Allegro++.
+// 
+// Allegro++ is free software: you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+// 
+// You should have received a copy of the GNU Lesser General Public License
+// along with Allegro++. If not, see <https://www.gnu.org/licenses/>.
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+#include <allegropp/maze.hpp>
+#include <cstddef>
+#include <memory>
+#include <string>
+
+namespace allegropp
+{
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @class chunked_maze
+// @author Eduardo Aguiar
+// @brief An unbounded maze, generated chunk by chunk on demand.
+//
+// The plane is split into square chunks. Each chunk is generated the first
+// time get or set touches it, from the seed and the chunk coordinates only,
+// so the same seed always yields the same maze wherever it is explored
+// first. Every chunk is a perfect maze joined to its west or north
+// neighbour through one passage, so the whole plane is a single tree.
+//
+// Loaded chunks are kept in an LRU cache within a memory budget. Evicted
+// chunks that were modified by set are spilled to files in a directory, or
+// kept in memory when no spill directory is given; unmodified chunks are
+// simply generated again when needed.
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+class chunked_maze
+{
+public:
+    // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+    // Prototypes
+    // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+    explicit chunked_maze (unsigned int seed = 0, int chunk_size = 64, std::size_t memory_budget = 64 << 20, const std::string& spill_dir = std::string (), maze::generator_type = maze::RECURSIVE_BACKTRACKER);
+    maze::wall_type get (int x, int y) const;
+    void set (int x, int y, maze::wall_type);
+    int get_chunk_size () const;
+    unsigned int get_seed () const;
+    maze::generator_type get_generator () const;
+    std::size_t get_loaded_chunks () const;
+
+private:
+    /// Forward declaration of the implementation struct
+    struct impl;
+
+    /// Shared pointer to the hidden implementation
+    std::shared_ptr<impl> impl_;
+};
+
+} // namespace allegropp
+
+#endif
@@ -21,15 +21,20 @@
 // along with Allegro++. If not, see <https://www.gnu.org/licenses/>.
 // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
 #include <allegro5/allegro_color.h>
-#include <memory>
+#include <cstddef>
 #include <string>
+#include <string_view>
 #include <tuple>
+#include <type_traits>
 
 namespace allegropp
 {
 // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
 //! \brief Allegro color class
 //! \author Eduardo Aguiar
+//!
+//! A plain value holding an ALLEGRO_COLOR: trivially copyable, never
+//! allocates, and constexpr-constructible from 8-bit components.
 // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
 class color
 {
@@ -42,11 +47,11 @@ public:
   // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
   // Constructors
   // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
-  color ();
-  color (component_type, component_type, component_type);
-  color (component_type, component_type, component_type, component_type);
-  color (color&&) noexcept = default;
-  color (const color&) noexcept = default;
+  constexpr color () noexcept = default;
+  constexpr color (component_type, component_type, component_type) noexcept;
+  constexpr color (component_type, component_type, component_type, component_type) noexcept;
+  constexpr color (color&&) noexcept = default;
+  constexpr color (const color&) noexcept = default;
 
   // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
   // Operators
@@ -61,21 +66,56 @@ public:
   std::tuple <component_type, component_type, component_type, component_type> get_rgba () const;
   std::string get_name () const;
   std::string get_html () const;
-  ALLEGRO_COLOR get_implementation () const;
+  constexpr ALLEGRO_COLOR get_implementation () const noexcept;
 
 private:
-  //! \brief Implementation class forward declaration
-  class impl;
-
-  //! \brief Implementation pointer
-  std::shared_ptr <impl> impl_;
+  //! \brief Allegro color object (transparent black by default)
+  ALLEGRO_COLOR obj_ = {0.0f, 0.0f, 0.0f, 0.0f};
 };
 
+static_assert (std::is_trivially_copyable_v <color>, "color must be trivially copyable");
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Constructor
+//! \param r Red component
+//! \param g Green component
+//! \param b Blue component
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+constexpr
+color::color (component_type r, component_type g, component_type b) noexcept
+  : obj_ {r / 255.0f, g / 255.0f, b / 255.0f, 1.0f}
+{
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Constructor
+//! \param r Red component
+//! \param g Green component
+//! \param b Blue component
+//! \param a Alpha component
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+constexpr
+color::color (component_type r, component_type g, component_type b, component_type a) noexcept
+  : obj_ {r / 255.0f, g / 255.0f, b / 255.0f, a / 255.0f}
+{
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Get implementation object
+//! \return Allegro color
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+constexpr ALLEGRO_COLOR
+color::get_implementation () const noexcept
+{
+  return obj_;
+}
+
 // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
 // Functions
 // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
-color new_color_by_name (const std::string&);
-color new_color_by_html (const std::string&);
+color new_color_by_name (std::string_view);
+color new_color_by_html (std::string_view);
+template <std::size_t N> constexpr color new_color_by_html (const char (&)[N]);
 color new_color_by_cmyk (float, float, float, float);
 color new_color_by_hsl (float, float, float);
 color new_color_by_hsv (float, float, float);
@@ -83,6 +123,90 @@ color new_color_by_yuv (float, float, float);
 color new_color_by_rgb (float, float, float);
 color new_color_by_rgba (float, float, float, float);
 
+namespace detail
+{
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Get value of an hexadecimal digit
+//! \param c Character
+//! \return Value (0..15), or -1 if c is not an hexadecimal digit
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+constexpr int
+html_hex_value (char c) noexcept
+{
+  if (c >= '0' && c <= '9')
+    return c - '0';
+
+  if (c >= 'a' && c <= 'f')
+    return c - 'a' + 10;
+
+  if (c >= 'A' && c <= 'F')
+    return c - 'A' + 10;
+
+  return -1;
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Parse "#rrggbb" (or "rrggbb") HTML color string
+//! \param html HTML string
+//! \param r Red component (output)
+//! \param g Green component (output)
+//! \param b Blue component (output)
+//! \return true if html is well formed, false otherwise
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+constexpr bool
+parse_html_color (
+  std::string_view html,
+  color::component_type& r,
+  color::component_type& g,
+  color::component_type& b
+) noexcept
+{
+  if (!html.empty () && html.front () == '#')
+    html.remove_prefix (1);
+
+  if (html.size () != 6)
+    return false;
+
+  int v[6] = {};
+
+  for (std::size_t i = 0; i < 6; i++)
+    {
+      v[i] = html_hex_value (html[i]);
+
+      if (v[i] < 0)
+        return false;
+    }
+
+  r = color::component_type (v[0] * 16 + v[1]);
+  g = color::component_type (v[2] * 16 + v[3]);
+  b = color::component_type (v[4] * 16 + v[5]);
+
+  return true;
+}
+
+} // namespace detail
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Create color by HTML string literal
+//! \param html HTML string
+//! \return New color object
+//!
+//! "#rrggbb" literals are parsed at compile time when used in a constant
+//! expression, e.g. constexpr color c = new_color_by_html ("#ff8000").
+//! Any other format is handed to Allegro at runtime.
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+template <std::size_t N>
+constexpr color
+new_color_by_html (const char (&html)[N])
+{
+  color::component_type r = 0, g = 0, b = 0;
+
+  if (detail::parse_html_color (std::string_view (html), r, g, b))
+    return color (r, g, b);
+
+  return new_color_by_html (std::string_view (html));
+}
+
 } // namespace allegropp
 
 #endif
\ No newline at end of file
@@ -0,0 +1,58 @@
+#ifndef ALLEGROPP_COLOR_BATCH
+#define ALLEGROPP_COLOR_BATCH
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @author      Eduardo Aguiar <aguiar@protonmail.ch>
+// @copyright   Copyright (c) 2025 Eduardo Aguiar
+//
+// This file is part of Allegro++.
+// 
+// Allegro++ is free software: you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+// 
+// You should have received a copy of the GNU Lesser General Public License
+// along with Allegro++. If not, see <https://www.gnu.org/licenses/>.
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+#include <allegro5/allegro.h>
+#include <cstddef>
+#include <cstdint>
+
+namespace allegropp
+{
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// Batch color-space conversions
+//
+// Each function converts count colors between packed arrays: HSV, HSL and
+// YUV hold three floats per color, CMYK holds four. RGBA is either an array
+// of ALLEGRO_COLOR or four bytes per color (0..255). Output alpha is opaque
+// and input alpha is ignored. Results match Allegro's al_color_* functions
+// and the new_color_by_* functions, color by color.
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+void colors_from_hsv (const float *, ALLEGRO_COLOR *, std::size_t);
+void colors_from_hsv (const float *, std::uint8_t *, std::size_t);
+void colors_from_hsl (const float *, ALLEGRO_COLOR *, std::size_t);
+void colors_from_hsl (const float *, std::uint8_t *, std::size_t);
+void colors_from_yuv (const float *, ALLEGRO_COLOR *, std::size_t);
+void colors_from_yuv (const float *, std::uint8_t *, std::size_t);
+void colors_from_cmyk (const float *, ALLEGRO_COLOR *, std::size_t);
+void colors_from_cmyk (const float *, std::uint8_t *, std::size_t);
+
+void colors_to_hsv (const ALLEGRO_COLOR *, float *, std::size_t);
+void colors_to_hsv (const std::uint8_t *, float *, std::size_t);
+void colors_to_hsl (const ALLEGRO_COLOR *, float *, std::size_t);
+void colors_to_hsl (const std::uint8_t *, float *, std::size_t);
+void colors_to_yuv (const ALLEGRO_COLOR *, float *, std::size_t);
+void colors_to_yuv (const std::uint8_t *, float *, std::size_t);
+void colors_to_cmyk (const ALLEGRO_COLOR *, float *, std::size_t);
+void colors_to_cmyk (const std::uint8_t *, float *, std::size_t);
+
+} // namespace allegropp
+
+#endif
@@ -23,7 +23,7 @@
 #include <allegropp/event_source.hpp>
 #include <allegro5/allegro.h>
 #include <memory>
-#include <string>
+#include <string_view>
 #include <utility>
 
 namespace allegropp
@@ -39,7 +39,7 @@ public:
   // Constructors
   // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
   display ();
-  display (std::size_t, std::size_t);
+  display (std::size_t, std::size_t, int = 0);
   display (display&&) noexcept = default;
   display (const display&) noexcept = default;
 
@@ -57,7 +57,7 @@ public:
   int get_height () const;
   void flip ();
   void resize (std::size_t, std::size_t);
-  void set_window_title (const std::string&);
+  void set_window_title (std::string_view);
   std::pair <int, int> get_window_position () const;
   void set_window_position (std::size_t, std::size_t);
   event_source get_event_source () const;
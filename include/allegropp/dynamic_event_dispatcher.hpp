@@ -0,0 +1,99 @@
+#ifndef ALLEGROPP_DYNAMIC_EVENT_DISPATCHER
+#define ALLEGROPP_DYNAMIC_EVENT_DISPATCHER
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @author      Eduardo Aguiar <aguiar@protonmail.ch>
+// @copyright   Copyright (c) 2025 Eduardo Aguiar
+//
+// This file is part of Allegro++.
+// 
+// Allegro++ is free software: you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+// 
+// You should have received a copy of the GNU Lesser General Public License
+// along with Allegro++. If not, see <https://www.gnu.org/licenses/>.
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+#include <allegro5/allegro.h>
+#include <allegropp/event_dispatcher.hpp>
+#include <allegropp/event_queue.hpp>
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <utility>
+
+namespace allegropp
+{
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Event dispatcher with handlers added and removed at run time
+//! \author Eduardo Aguiar
+//!
+//! Meant for plugins and other handlers not known at compile time. Handlers
+//! are stored as std::function and looked up by event type, so dispatching
+//! costs more than an event_dispatcher. Handlers must not add or remove
+//! handlers while being dispatched.
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+class dynamic_event_dispatcher
+{
+public:
+  // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+  // Datatypes
+  // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+  using handler_type = std::function <void (const ALLEGRO_EVENT&)>;
+  using handler_id = std::size_t;
+
+  // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+  // Constructors
+  // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+  dynamic_event_dispatcher ();
+  dynamic_event_dispatcher (dynamic_event_dispatcher&&) noexcept = default;
+  dynamic_event_dispatcher (const dynamic_event_dispatcher&) noexcept = default;
+
+  // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+  // Operators
+  // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+  dynamic_event_dispatcher& operator= (const dynamic_event_dispatcher&) noexcept = default;
+  dynamic_event_dispatcher& operator= (dynamic_event_dispatcher&&) noexcept = default;
+
+  // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+  // Function prototypes
+  // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+  handler_id add_handler (ALLEGRO_EVENT_TYPE, handler_type);
+  bool remove_handler (handler_id);
+  std::size_t get_handler_count () const;
+  bool dispatch (const ALLEGRO_EVENT&) const;
+  std::size_t dispatch_pending (event_queue&) const;
+
+  // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+  //! \brief Add handler taking the typed view of its events
+  //! \param f Function object, taking event_traits <Type>::type or
+  //!        ALLEGRO_EVENT
+  //! \return Handler ID, for remove_handler
+  // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+  template <ALLEGRO_EVENT_TYPE Type, typename F>
+  handler_id
+  add_handler (F f)
+  {
+    return add_handler (Type, [f = std::move (f)](const ALLEGRO_EVENT& event) mutable
+    {
+      invoke_event_handler <Type> (f, event);
+    });
+  }
+
+private:
+  //! \brief Implementation class forward declaration
+  class impl;
+
+  //! \brief Implementation pointer
+  std::shared_ptr <impl> impl_;
+};
+
+} // namespace allegropp
+
+#endif
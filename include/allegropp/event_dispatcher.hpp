@@ -0,0 +1,308 @@
+#ifndef ALLEGROPP_EVENT_DISPATCHER
+#define ALLEGROPP_EVENT_DISPATCHER
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @author      Eduardo Aguiar <aguiar@protonmail.ch>
+// @copyright   Copyright (c) 2025 Eduardo Aguiar
+//
+// This file is part of Allegro++.
+// 
+// Allegro++ is free software: you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+// 
+// You should have received a copy of the GNU Lesser General Public License
+// along with Allegro++. If not, see <https://www.gnu.org/licenses/>.
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+#include <allegro5/allegro.h>
+#include <allegropp/event_queue.hpp>
+#include <cstddef>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+namespace allegropp
+{
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Typed view of an event type
+//!
+//! event_traits <Type>::type is the ALLEGRO_EVENT member that Type events
+//! fill in, and get returns it. Types not listed, such as user events, are
+//! seen as the whole ALLEGRO_EVENT.
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+template <ALLEGRO_EVENT_TYPE Type>
+struct event_traits
+{
+  using type = ALLEGRO_EVENT;
+  static constexpr const type& get (const ALLEGRO_EVENT& event) noexcept { return event; }
+};
+
+//! \brief Joystick event traits
+struct joystick_event_traits
+{
+  using type = decltype (ALLEGRO_EVENT::joystick);
+  static constexpr const type& get (const ALLEGRO_EVENT& event) noexcept { return event.joystick; }
+};
+
+//! \brief Keyboard event traits
+struct keyboard_event_traits
+{
+  using type = decltype (ALLEGRO_EVENT::keyboard);
+  static constexpr const type& get (const ALLEGRO_EVENT& event) noexcept { return event.keyboard; }
+};
+
+//! \brief Mouse event traits
+struct mouse_event_traits
+{
+  using type = decltype (ALLEGRO_EVENT::mouse);
+  static constexpr const type& get (const ALLEGRO_EVENT& event) noexcept { return event.mouse; }
+};
+
+//! \brief Timer event traits
+struct timer_event_traits
+{
+  using type = decltype (ALLEGRO_EVENT::timer);
+  static constexpr const type& get (const ALLEGRO_EVENT& event) noexcept { return event.timer; }
+};
+
+//! \brief Display event traits
+struct display_event_traits
+{
+  using type = decltype (ALLEGRO_EVENT::display);
+  static constexpr const type& get (const ALLEGRO_EVENT& event) noexcept { return event.display; }
+};
+
+//! \brief Touch event traits
+struct touch_event_traits
+{
+  using type = decltype (ALLEGRO_EVENT::touch);
+  static constexpr const type& get (const ALLEGRO_EVENT& event) noexcept { return event.touch; }
+};
+
+template <> struct event_traits <ALLEGRO_EVENT_JOYSTICK_AXIS> : joystick_event_traits {};
+template <> struct event_traits <ALLEGRO_EVENT_JOYSTICK_BUTTON_DOWN> : joystick_event_traits {};
+template <> struct event_traits <ALLEGRO_EVENT_JOYSTICK_BUTTON_UP> : joystick_event_traits {};
+template <> struct event_traits <ALLEGRO_EVENT_JOYSTICK_CONFIGURATION> : joystick_event_traits {};
+template <> struct event_traits <ALLEGRO_EVENT_KEY_DOWN> : keyboard_event_traits {};
+template <> struct event_traits <ALLEGRO_EVENT_KEY_CHAR> : keyboard_event_traits {};
+template <> struct event_traits <ALLEGRO_EVENT_KEY_UP> : keyboard_event_traits {};
+template <> struct event_traits <ALLEGRO_EVENT_MOUSE_AXES> : mouse_event_traits {};
+template <> struct event_traits <ALLEGRO_EVENT_MOUSE_BUTTON_DOWN> : mouse_event_traits {};
+template <> struct event_traits <ALLEGRO_EVENT_MOUSE_BUTTON_UP> : mouse_event_traits {};
+template <> struct event_traits <ALLEGRO_EVENT_MOUSE_ENTER_DISPLAY> : mouse_event_traits {};
+template <> struct event_traits <ALLEGRO_EVENT_MOUSE_LEAVE_DISPLAY> : mouse_event_traits {};
+template <> struct event_traits <ALLEGRO_EVENT_MOUSE_WARPED> : mouse_event_traits {};
+template <> struct event_traits <ALLEGRO_EVENT_TIMER> : timer_event_traits {};
+template <> struct event_traits <ALLEGRO_EVENT_DISPLAY_EXPOSE> : display_event_traits {};
+template <> struct event_traits <ALLEGRO_EVENT_DISPLAY_RESIZE> : display_event_traits {};
+template <> struct event_traits <ALLEGRO_EVENT_DISPLAY_CLOSE> : display_event_traits {};
+template <> struct event_traits <ALLEGRO_EVENT_DISPLAY_LOST> : display_event_traits {};
+template <> struct event_traits <ALLEGRO_EVENT_DISPLAY_FOUND> : display_event_traits {};
+template <> struct event_traits <ALLEGRO_EVENT_DISPLAY_SWITCH_IN> : display_event_traits {};
+template <> struct event_traits <ALLEGRO_EVENT_DISPLAY_SWITCH_OUT> : display_event_traits {};
+template <> struct event_traits <ALLEGRO_EVENT_DISPLAY_ORIENTATION> : display_event_traits {};
+template <> struct event_traits <ALLEGRO_EVENT_DISPLAY_HALT_DRAWING> : display_event_traits {};
+template <> struct event_traits <ALLEGRO_EVENT_DISPLAY_RESUME_DRAWING> : display_event_traits {};
+template <> struct event_traits <ALLEGRO_EVENT_TOUCH_BEGIN> : touch_event_traits {};
+template <> struct event_traits <ALLEGRO_EVENT_TOUCH_END> : touch_event_traits {};
+template <> struct event_traits <ALLEGRO_EVENT_TOUCH_MOVE> : touch_event_traits {};
+template <> struct event_traits <ALLEGRO_EVENT_TOUCH_CANCEL> : touch_event_traits {};
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Call a handler with the typed view of an event
+//! \param f Handler, taking event_traits <Type>::type or ALLEGRO_EVENT
+//! \param event Event, of type Type
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+template <ALLEGRO_EVENT_TYPE Type, typename F>
+constexpr void
+invoke_event_handler (F& f, const ALLEGRO_EVENT& event)
+{
+  using view_type = typename event_traits <Type>::type;
+
+  if constexpr (std::is_invocable_v <F&, const view_type&>)
+    f (event_traits <Type>::get (event));
+
+  else
+    {
+      static_assert (std::is_invocable_v <F&, const ALLEGRO_EVENT&>, "event handler must take the event type view or ALLEGRO_EVENT");
+      f (event);
+    }
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Handler bound to an event type. Made by on <Type> (...)
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+template <ALLEGRO_EVENT_TYPE Type, typename F>
+class event_handler
+{
+public:
+  //! \brief Event type
+  static constexpr ALLEGRO_EVENT_TYPE event_type = Type;
+
+  // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+  //! \brief Constructor
+  //! \param f Handler function object
+  // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+  constexpr explicit
+  event_handler (F f)
+    : f_ (std::move (f))
+  {
+  }
+
+  // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+  //! \brief Handle event, if it has the handler event type
+  //! \param event Event
+  //! \return true if the event was handled
+  // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+  constexpr bool
+  operator() (const ALLEGRO_EVENT& event)
+  {
+    if (event.type != Type)
+      return false;
+
+    invoke_event_handler <Type> (f_, event);
+    return true;
+  }
+
+private:
+  //! \brief Handler function object
+  F f_;
+};
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Bind a function object to an event type
+//! \param f Function object (lambda, etc), taking event_traits <Type>::type
+//!        or ALLEGRO_EVENT
+//! \return Handler
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+template <ALLEGRO_EVENT_TYPE Type, typename F>
+constexpr event_handler <Type, F>
+on (F f)
+{
+  return event_handler <Type, F> (std::move (f));
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Bind a member function to an event type
+//! \param method Member function, taking event_traits <Type>::type or
+//!        ALLEGRO_EVENT
+//! \param object Object. It must outlive the handler
+//! \return Handler
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+template <ALLEGRO_EVENT_TYPE Type, typename C, typename M>
+constexpr auto
+on (M C::*method, C *object)
+{
+  return on <Type> ([method, object](const auto& event) -> decltype ((object->*method) (event))
+  {
+    return (object->*method) (event);
+  });
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Event dispatcher, with its handler table fixed at compile time
+//! \author Eduardo Aguiar
+//!
+//! Handlers are stored by value and each one is tested with one comparison,
+//! in a fold expression the compiler inlines. Optimizing compilers turn it
+//! into the code of a switch on the event type, with no virtual or
+//! std::function call. Every handler bound to the event type is called, in
+//! the order given.
+//!
+//! \code
+//! allegropp::event_dispatcher dispatcher (
+//!   allegropp::on <ALLEGRO_EVENT_DISPLAY_CLOSE> ([&](const auto&) { done = true; }),
+//!   allegropp::on <ALLEGRO_EVENT_KEY_DOWN> (&game::on_key_down, &game));
+//!
+//! dispatcher.dispatch_pending (event_queue);
+//! \endcode
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+template <typename... Handlers>
+class event_dispatcher
+{
+public:
+  // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+  //! \brief Constructor
+  //! \param handlers Handlers, made by on <Type> (...)
+  // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+  constexpr explicit
+  event_dispatcher (Handlers... handlers)
+    : handlers_ (std::move (handlers)...)
+  {
+  }
+
+  // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+  //! \brief Dispatch event
+  //! \param event Event
+  //! \return true if a handler took the event. Unhandled events can be
+  //!         passed on, to a dynamic_event_dispatcher for instance
+  // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+  constexpr bool
+  dispatch (const ALLEGRO_EVENT& event)
+  {
+    return dispatch (event, std::index_sequence_for <Handlers...> ());
+  }
+
+  // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+  //! \brief Dispatch all pending events of a queue, without waiting
+  //! \param queue Event queue
+  //! \return Number of events dispatched
+  // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+  std::size_t
+  dispatch_pending (event_queue& queue)
+  {
+    ALLEGRO_EVENT events[BATCH_SIZE];
+    std::size_t total = 0;
+    std::size_t count;
+
+    do
+      {
+        count = queue.drain (events);
+
+        for (std::size_t i = 0; i < count; i++)
+          dispatch (events[i]);
+
+        total += count;
+      }
+    while (count == BATCH_SIZE);
+
+    return total;
+  }
+
+private:
+  //! \brief Number of events taken from the queue at a time
+  static constexpr std::size_t BATCH_SIZE = 64;
+
+  // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+  //! \brief Dispatch event to every handler
+  //! \param event Event
+  //! \return true if a handler took the event
+  // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+  template <std::size_t... I>
+  constexpr bool
+  dispatch (const ALLEGRO_EVENT& event, std::index_sequence <I...>)
+  {
+    bool handled = false;
+    ((handled = std::get <I> (handlers_) (event) || handled), ...);
+    return handled;
+  }
+
+  //! \brief Handlers
+  std::tuple <Handlers...> handlers_;
+};
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Deduction guide, so event_dispatcher (on <...> (...), ...) works
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+template <typename... Handlers>
+event_dispatcher (Handlers...) -> event_dispatcher <Handlers...>;
+
+} // namespace allegropp
+
+#endif
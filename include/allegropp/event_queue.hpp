@@ -23,6 +23,8 @@
 #include <allegro5/allegro.h>
 #include <allegropp/display.hpp>
 #include <allegropp/timer.hpp>
+#include <chrono>
+#include <cstddef>
 #include <memory>
 
 namespace allegropp
@@ -55,6 +57,22 @@ public:
   void add_timer_events (const timer&);
   void add_display_events (const display&);
   void get_event (ALLEGRO_EVENT&);
+  bool try_get_event (ALLEGRO_EVENT&);
+  bool wait_for_event_until (ALLEGRO_EVENT&, std::chrono::steady_clock::time_point);
+  bool peek (ALLEGRO_EVENT&) const;
+  std::size_t drain (ALLEGRO_EVENT *, std::size_t);
+
+  // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+  //! \brief Get all pending events, up to the array size
+  //! \param events Event array
+  //! \return Number of events got
+  // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+  template <std::size_t N>
+  std::size_t
+  drain (ALLEGRO_EVENT (&events)[N])
+  {
+    return drain (events, N);
+  }
 
 private:
   //! \brief Implementation class forward declaration
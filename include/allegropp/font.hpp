@@ -24,6 +24,8 @@
 #include <allegro5/allegro_font.h>
 #include <memory>
 #include <string>
+#include <string_view>
+#include <vector>
 
 namespace allegropp
 {
@@ -33,12 +35,22 @@ namespace allegropp
 // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
 class font
 {
+private:
+  //! \brief Implementation class forward declaration
+  class impl;
+
+  //! \brief Implementation pointer
+  std::shared_ptr <impl> impl_;
+
+  friend class resource_cache;
+
 public:
   // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
   // Constructors
   // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
   font ();
-  font (const std::string&, std::size_t);
+  font (const std::string&, std::size_t, int = 0);
+  font (const std::shared_ptr <impl>&);
   font (font&&) noexcept = default;
   font (const font&) noexcept = default;
 
@@ -55,19 +67,19 @@ public:
   int get_font_line_height () const;
   int get_font_ascent () const;
   int get_font_descent () const;
-  int get_text_width (const std::string&) const;
-  void draw_text_left (int, int, const std::string&, const color&);
-  void draw_text_center (int, int, const std::string&, const color&);
-  void draw_text_right (int, int, const std::string&, const color&);
-
-private:
-  //! \brief Implementation class forward declaration
-  class impl;
-
-  //! \brief Implementation pointer
-  std::shared_ptr <impl> impl_;
+  int get_text_width (std::string_view) const;
+  void draw_text_left (int, int, std::string_view, const color&);
+  void draw_text_center (int, int, std::string_view, const color&);
+  void draw_text_right (int, int, std::string_view, const color&);
+  void prewarm_glyphs (std::string_view) const;
+  ALLEGRO_FONT *get_implementation () const;
 };
 
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// Functions
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+void bake_font (const std::string&, const std::vector <std::size_t>&, std::string_view, const std::string&, int = 0);
+
 } // namespace allegropp
 
 #endif
\ No newline at end of file
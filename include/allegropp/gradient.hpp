@@ -0,0 +1,114 @@
+#ifndef ALLEGROPP_GRADIENT
+#define ALLEGROPP_GRADIENT
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @author      Eduardo Aguiar <aguiar@protonmail.ch>
+// @copyright   Copyright (c) 2025 Eduardo Aguiar
+//
+// This file is part of Allegro++.
+// 
+// Allegro++ is free software: you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+// 
+// You should have received a copy of the GNU Lesser General Public License
+// along with Allegro++. If not, see <https://www.gnu.org/licenses/>.
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+#include <allegropp/bitmap.hpp>
+#include <allegropp/color.hpp>
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace allegropp
+{
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Color gradient, baked into a palette lookup table
+//! \author Eduardo Aguiar
+//!
+//! Color stops are interpolated once, at construction, into a power of two
+//! sized table of ALLEGRO_COLOR (usually 256 or 4096 entries). Lookups are
+//! plain array indexing: indices wrap around the table, which suits palette
+//! cycling, and positions are clamped to 0..1.
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+class gradient
+{
+public:
+  // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+  // Datatypes
+  // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+  enum interpolation_type : std::uint8_t
+  {
+    RGB = 0,        //!< Straight sRGB component blend
+    HSV,            //!< HSV blend, along the shortest hue arc
+    LINEAR_RGB      //!< Blend in linear light, then back to sRGB
+  };
+
+  //! \brief Color stop
+  struct stop
+  {
+    float position;     //!< Position (0..1)
+    color value;        //!< Color at position
+  };
+
+  // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+  // Constructors
+  // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+  explicit gradient (const std::vector <stop>&, std::size_t = 256, interpolation_type = RGB);
+  gradient (gradient&&) noexcept = default;
+  gradient (const gradient&) = default;
+
+  // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+  // Operators
+  // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+  gradient& operator= (const gradient&) = default;
+  gradient& operator= (gradient&&) noexcept = default;
+
+  // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+  //! \brief Get table entry
+  //! \param i Entry index, wrapped around the table size
+  //! \return Allegro color
+  // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+  const ALLEGRO_COLOR&
+  operator[] (std::size_t i) const noexcept
+  {
+    return lut_[i & mask_];
+  }
+
+  // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+  //! \brief Get color at position
+  //! \param t Position, clamped to 0..1. NaN maps to 0
+  //! \return Allegro color of the nearest table entry
+  // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+  const ALLEGRO_COLOR&
+  get (float t) const noexcept
+  {
+    const float u = t > 0.0f ? (t < 1.0f ? t : 1.0f) : 0.0f;
+    return lut_[std::size_t (u * scale_ + 0.5f)];
+  }
+
+  // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+  // Function prototypes
+  // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+  std::size_t get_size () const noexcept;
+  const ALLEGRO_COLOR *get_data () const noexcept;
+  interpolation_type get_interpolation () const noexcept;
+  bitmap get_bitmap () const;
+
+private:
+  std::vector <ALLEGRO_COLOR> lut_;     //!< Lookup table
+  std::size_t mask_ = 0;                //!< Table size - 1
+  float scale_ = 0;                     //!< Table size - 1, as float
+  interpolation_type interpolation_ = RGB;
+};
+
+} // namespace allegropp
+
+#endif
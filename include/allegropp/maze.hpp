@@ -22,6 +22,7 @@
 // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
 #include <cstdint>
 #include <memory>
+#include <string>
 
 namespace allegropp
 {
@@ -31,9 +32,11 @@ namespace allegropp
 // @brief A class to generate and manage a 2D maze with customizable obstacle types.
 // @see https://www.astrolog.org/labyrnth/algrithm.htm
 //
-// This class uses a variant of the Recursive Backtracking algorithm to create
-// a perfect maze with wider paths (two-cell steps). It supports different wall
-// types and allows querying and modifying the maze grid.
+// This class creates a perfect maze with wider paths (two-cell steps), using
+// Recursive Backtracking by default or one of the other generator_type
+// algorithms. It supports different wall types and allows querying and
+// modifying the maze grid. The grid can be kept as bytes, bits or run-length
+// encoded rows (see storage_type).
 // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
 class maze
 {
@@ -48,17 +51,49 @@ public:
         // Add more types as needed (up to 255)
     };
 
+    // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+    // @brief Storage backends for the maze grid
+    // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+    enum storage_type : std::uint8_t
+    {
+        BYTE_STORAGE = 0,    ///< One byte per cell, any wall type
+        BIT_STORAGE = 1,     ///< One bit per cell, PASSAGE and WALL only
+        RLE_STORAGE = 2,     ///< Run-length encoded rows, for mostly-open maps
+    };
+
+    // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+    // @brief Maze generation algorithms
+    // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+    enum generator_type : std::uint8_t
+    {
+        RECURSIVE_BACKTRACKER = 0,  ///< Long winding corridors, few dead ends
+        ELLER = 1,           ///< Row by row, O(width) memory (see maze_row_stream)
+        WILSON = 2,          ///< Loop-erased random walks, unbiased
+        KRUSKAL = 3,         ///< Random edges joined by union-find
+        PRIM = 4,            ///< Grown from a random cell, many short dead ends
+        BINARY_TREE = 5,     ///< Each cell opens north or west, diagonal bias
+        SIDEWINDER = 6,      ///< Row runs opening north, open top corridor
+    };
+
     // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
     // Prototypes
     // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
-    explicit maze (int width, int height, unsigned int seed = 0);
+    explicit maze (int width, int height, unsigned int seed = 0, storage_type = BYTE_STORAGE, generator_type = RECURSIVE_BACKTRACKER, int threads = 1);
+    explicit maze (const std::string& path);
     wall_type get (int x, int y) const;
     void set (int x, int y, wall_type);
     int get_width () const;
     int get_height () const;
     unsigned int get_seed () const;
+    storage_type get_storage () const;
+    generator_type get_generator () const;
+    void save (const std::string& path) const;
 
 private:
+    friend class maze_flow_field;
+    friend class maze_pathfinder;
+    friend class maze_renderer;
+
     /// Forward declaration of the implementation struct
     struct impl;
 
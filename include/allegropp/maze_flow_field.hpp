@@ -0,0 +1,72 @@
+#ifndef ALLEGROPP_MAZE_FLOW_FIELD
+#define ALLEGROPP_MAZE_FLOW_FIELD
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @author      Eduardo Aguiar <aguiar@protonmail.ch>
+// @copyright   Copyright (c) 2025 Eduardo Aguiar
+//
+// This file is part of Allegro++.
+// 
+// Allegro++ is free software: you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+// 
+// You should have received a copy of the GNU Lesser General Public License
+// along with Allegro++. If not, see <https://www.gnu.org/licenses/>.
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+#include <allegropp/maze.hpp>
+#include <memory>
+#include <utility>
+#include <vector>
+
+namespace allegropp
+{
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @class maze_flow_field
+// @author Eduardo Aguiar
+// @brief Distance field from one or more goal cells over a maze.
+//
+// Holds, for every PASSAGE cell, the number of 4-connected steps to the
+// nearest goal, computed in a single breadth-first wavefront. Agents follow
+// get_direction instead of running one path search each.
+//
+// Cells changed with maze::set are applied by update, which repairs only the
+// part of the field affected by each change. Buffers are kept between calls.
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+class maze_flow_field
+{
+public:
+    // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+    // Datatypes
+    // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+    using point_type = std::pair <int, int>;
+
+    /// Distance of walls and of cells that cannot reach any goal
+    static constexpr int UNREACHABLE = -1;
+
+    // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+    // Prototypes
+    // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+    explicit maze_flow_field (const maze&);
+    void set_goals (const std::vector <point_type>&);
+    void update ();
+    int get_distance (int, int) const;
+    point_type get_direction (int, int) const;
+
+private:
+    /// Forward declaration of the implementation struct
+    struct impl;
+
+    /// Shared pointer to the hidden implementation
+    std::shared_ptr<impl> impl_;
+};
+
+} // namespace allegropp
+
+#endif
@@ -0,0 +1,84 @@
+#ifndef ALLEGROPP_MAZE_PATHFINDER
+#define ALLEGROPP_MAZE_PATHFINDER
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @author      Eduardo Aguiar <aguiar@protonmail.ch>
+// @copyright   Copyright (c) 2025 Eduardo Aguiar
+//
+// This file is part of Allegro++.
+// 
+// Allegro++ is free software: you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+// 
+// You should have received a copy of the GNU Lesser General Public License
+// along with Allegro++. If not, see <https://www.gnu.org/licenses/>.
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+#include <allegropp/maze.hpp>
+#include <cstddef>
+#include <memory>
+#include <utility>
+#include <vector>
+
+namespace allegropp
+{
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @class maze_pathfinder
+// @author Eduardo Aguiar
+// @brief Shortest path queries over a maze grid.
+// @see https://harablog.wordpress.com/2011/09/07/jump-point-search/
+//
+// Agents move between 4-connected PASSAGE cells at uniform cost. Three
+// searches are available: breadth-first distance, A* with a pluggable
+// heuristic, and Jump Point Search (JPS). The searches read the maze grid
+// directly, so changes made with maze::set are seen by the next query.
+//
+// Per-cell buffers are allocated on the first query and reused by the
+// following ones, so steady-state queries do not allocate. A pathfinder is
+// not thread-safe; use one instance per thread.
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+class maze_pathfinder
+{
+public:
+    // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+    // Datatypes
+    // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+    using point_type = std::pair <int, int>;
+    using path_type = std::vector <point_type>;
+
+    /// Heuristic: estimated cost for absolute offsets (dx, dy) to the goal
+    using heuristic_type = int (*) (int, int);
+
+    // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+    // Heuristics
+    // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+    static int manhattan (int, int);
+    static int euclidean (int, int);
+    static int zero (int, int);
+
+    // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+    // Prototypes
+    // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+    explicit maze_pathfinder (const maze&);
+    int get_bfs_distance (int, int, int, int);
+    bool find_path_astar (int, int, int, int, path_type&, heuristic_type = manhattan);
+    bool find_path_jps (int, int, int, int, path_type&);
+    std::size_t get_expanded_nodes () const;
+
+private:
+    /// Forward declaration of the implementation struct
+    struct impl;
+
+    /// Shared pointer to the hidden implementation
+    std::shared_ptr<impl> impl_;
+};
+
+} // namespace allegropp
+
+#endif
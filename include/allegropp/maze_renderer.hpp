@@ -0,0 +1,68 @@
+#ifndef ALLEGROPP_MAZE_RENDERER
+#define ALLEGROPP_MAZE_RENDERER
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @author      Eduardo Aguiar <aguiar@protonmail.ch>
+// @copyright   Copyright (c) 2025 Eduardo Aguiar
+//
+// This file is part of Allegro++.
+// 
+// Allegro++ is free software: you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+// 
+// You should have received a copy of the GNU Lesser General Public License
+// along with Allegro++. If not, see <https://www.gnu.org/licenses/>.
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+#include <allegropp/color.hpp>
+#include <allegropp/maze.hpp>
+#include <cstddef>
+#include <memory>
+
+namespace allegropp
+{
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @class maze_renderer
+// @author Eduardo Aguiar
+// @brief Draws a maze with a few batched primitive calls.
+//
+// The maze is split into tiles of 64 x 64 cells. The wall quads of each tile
+// are built once into a vertex buffer (or a vertex array, where vertex
+// buffers are not supported) and drawn with a single call. Only the tiles
+// touched by maze::set since the last draw are rebuilt, and tiles outside
+// the view rectangle are skipped, so the number of draw calls depends on
+// the view size rather than on the maze size.
+//
+// Without a gap between cells, horizontal runs of the same wall type are
+// merged into a single quad.
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+class maze_renderer
+{
+public:
+    // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+    // Prototypes
+    // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+    maze_renderer (const maze&, float cell_width, float cell_height);
+    void set_color (maze::wall_type, const color&);
+    void set_gap (float);
+    void draw (float x, float y);
+    void draw (float x, float y, float view_x, float view_y, float view_width, float view_height);
+    std::size_t get_draw_calls () const;
+
+private:
+    /// Forward declaration of the implementation struct
+    struct impl;
+
+    /// Shared pointer to the hidden implementation
+    std::shared_ptr<impl> impl_;
+};
+
+} // namespace allegropp
+
+#endif
@@ -0,0 +1,60 @@
+#ifndef ALLEGROPP_MAZE_ROW_STREAM
+#define ALLEGROPP_MAZE_ROW_STREAM
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @author      Eduardo Aguiar <aguiar@protonmail.ch>
+// @copyright   Copyright (c) 2025 Eduardo Aguiar
+//
+// This file is part of Allegro++.
+// 
+// Allegro++ is free software: you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+// 
+// You should have received a copy of the GNU Lesser General Public License
+// along with Allegro++. If not, see <https://www.gnu.org/licenses/>.
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+#include <allegropp/maze.hpp>
+#include <memory>
+#include <vector>
+
+namespace allegropp
+{
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @class maze_row_stream
+// @author Eduardo Aguiar
+// @brief Generates a maze one grid row at a time.
+//
+// Uses Eller's algorithm, which only needs the current row of cells, so
+// memory is O(width) and the height can be arbitrarily large. The rows are
+// the same as those of maze (width, height, seed, storage, maze::ELLER).
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+class maze_row_stream
+{
+public:
+    // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+    // Prototypes
+    // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+    maze_row_stream (int width, int height, unsigned int seed = 0);
+    bool get_row (std::vector <maze::wall_type>&);
+    int get_width () const;
+    int get_height () const;
+    unsigned int get_seed () const;
+
+private:
+    /// Forward declaration of the implementation struct
+    struct impl;
+
+    /// Shared pointer to the hidden implementation
+    std::shared_ptr<impl> impl_;
+};
+
+} // namespace allegropp
+
+#endif
@@ -0,0 +1,108 @@
+#ifndef ALLEGROPP_RESOURCE_CACHE
+#define ALLEGROPP_RESOURCE_CACHE
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @author      Eduardo Aguiar <aguiar@protonmail.ch>
+// @copyright   Copyright (c) 2025 Eduardo Aguiar
+//
+// This file is part of Allegro++.
+// 
+// Allegro++ is free software: you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+// 
+// You should have received a copy of the GNU Lesser General Public License
+// along with Allegro++. If not, see <https://www.gnu.org/licenses/>.
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+#include <allegropp/bitmap.hpp>
+#include <allegropp/font.hpp>
+#include <allegropp/sample.hpp>
+#include <cstddef>
+#include <memory>
+#include <string>
+
+namespace allegropp
+{
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Deduplicating bitmap, font and sample cache
+//! \author Eduardo Aguiar
+//!
+//! Resources are keyed by path and loading parameters. While a resource is
+//! in use anywhere, requests for the same key share it: the cache only
+//! holds weak references. On top of that, recently used resources are kept
+//! alive in LRU order, up to a budget in bytes, so resources released and
+//! requested again soon are not reloaded. A budget of 0 keeps nothing alive.
+//!
+//! Sizes are estimates: pixels for bitmaps, decoded samples for samples and
+//! file size for fonts (TTF glyph caches are not counted). Loading happens
+//! on the calling thread, so bitmaps and fonts should be requested on the
+//! display thread. All functions are thread-safe.
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+class resource_cache
+{
+public:
+  // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+  // Datatypes
+  // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+  //! \brief Cache counters
+  struct statistics
+  {
+    std::size_t hits = 0;               //!< Requests served from cache
+    std::size_t misses = 0;             //!< Requests loading a resource
+    std::size_t evictions = 0;          //!< Resources dropped from the LRU list
+    std::size_t bytes = 0;              //!< Bytes kept alive by the LRU list
+    std::size_t retained = 0;           //!< Resources kept alive by the LRU list
+
+    //! \brief Get fraction of requests served from cache (0..1)
+    float
+    get_hit_rate () const noexcept
+    {
+      return hits + misses ? float (hits) / float (hits + misses) : 0.0f;
+    }
+  };
+
+  // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+  // Constructors
+  // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+  explicit resource_cache (std::size_t = 0);
+  resource_cache (resource_cache&&) noexcept = default;
+  resource_cache (const resource_cache&) noexcept = default;
+
+  // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+  // Operators
+  // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+  resource_cache& operator= (const resource_cache&) noexcept = default;
+  resource_cache& operator= (resource_cache&&) noexcept = default;
+
+  // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+  // Function prototypes
+  // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+  bitmap get_bitmap (const std::string&, int = 0);
+  font get_font (const std::string&, std::size_t, int = 0);
+  sample get_sample (const std::string&);
+  void set_budget (std::size_t);
+  std::size_t get_budget () const;
+  statistics get_statistics () const;
+  void reset_statistics ();
+  void clear ();
+
+private:
+  //! \brief Implementation class forward declaration
+  class impl;
+
+  //! \brief Implementation pointer
+  std::shared_ptr <impl> impl_;
+
+  template <typename T> static std::shared_ptr <void> get_pointer (const T&);
+  template <typename T> static T from_pointer (const std::shared_ptr <void>&);
+};
+
+} // namespace allegropp
+
+#endif
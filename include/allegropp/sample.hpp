@@ -20,6 +20,7 @@
 // You should have received a copy of the GNU Lesser General Public License
 // along with Allegro++. If not, see <https://www.gnu.org/licenses/>.
 // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+#include <allegro5/allegro_audio.h>
 #include <memory>
 #include <string>
 
@@ -31,12 +32,22 @@ namespace allegropp
 // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
 class sample
 {
+private:
+  //! \brief Implementation class forward declaration
+  class impl;
+
+  //! \brief Implementation pointer
+  std::shared_ptr <impl> impl_;
+
+  friend class resource_cache;
+
 public:
   // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
   // Constructors
   // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
   sample ();
   explicit sample (const std::string&);
+  sample (const std::shared_ptr <impl>&);
   sample (sample&&) noexcept = default;
   sample (const sample&) noexcept = default;
 
@@ -53,13 +64,7 @@ public:
   void play_once (double = 1.0, double = 0.0, double = 1.0);
   void play_loop (double = 1.0, double = 0.0, double = 1.0);
   void play_bidir (double = 1.0, double = 0.0, double = 1.0);
-  
-private:
-  //! \brief Implementation class forward declaration
-  class impl;
-
-  //! \brief Implementation pointer
-  std::shared_ptr <impl> impl_;
+  ALLEGRO_SAMPLE *get_implementation () const;
 };
 
 } // namespace allegropp
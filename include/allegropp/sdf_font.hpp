@@ -0,0 +1,87 @@
+#ifndef ALLEGROPP_SDF_FONT
+#define ALLEGROPP_SDF_FONT
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @author      Eduardo Aguiar <aguiar@protonmail.ch>
+// @copyright   Copyright (c) 2025 Eduardo Aguiar
+//
+// This file is part of Allegro++.
+// 
+// Allegro++ is free software: you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+// 
+// You should have received a copy of the GNU Lesser General Public License
+// along with Allegro++. If not, see <https://www.gnu.org/licenses/>.
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+#include <allegropp/atlas.hpp>
+#include <allegropp/color.hpp>
+#include <cstddef>
+#include <memory>
+#include <string>
+#include <string_view>
+
+namespace allegropp
+{
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Signed distance field font, drawn at any size from one atlas
+//! \author Eduardo Aguiar
+//!
+//! On load, each glyph of a character set is rasterized once at the base
+//! size, and turned into a distance field (distance to the glyph outline,
+//! <i>spread</i> pixels each way) on worker threads. Distance fields are
+//! packed into an atlas, sampled with linear filtering and thresholded by
+//! a pixel shader, so text stays sharp when scaled up or down.
+//!
+//! Drawing needs a display created with ALLEGRO_PROGRAMMABLE_PIPELINE. The
+//! shader is created on the first draw. Code points missing from the
+//! character set are drawn as '?', if it is in the set.
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+class sdf_font
+{
+public:
+  // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+  // Constructors
+  // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+  explicit sdf_font (const std::string&, std::string_view = {}, int = 64, int = 8, unsigned int = 1);
+  sdf_font (sdf_font&&) noexcept = default;
+  sdf_font (const sdf_font&) noexcept = default;
+
+  // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+  // Operators
+  // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+  sdf_font& operator= (const sdf_font&) noexcept = default;
+  sdf_font& operator= (sdf_font&&) noexcept = default;
+
+  // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+  // Function prototypes
+  // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+  int get_base_size () const;
+  int get_spread () const;
+  std::size_t get_glyph_count () const;
+  const atlas& get_atlas () const;
+  float get_font_line_height (float) const;
+  float get_font_ascent (float) const;
+  float get_font_descent (float) const;
+  float get_text_width (float, std::string_view) const;
+  void draw_text_left (float, float, float, std::string_view, const color&) const;
+  void draw_text_center (float, float, float, std::string_view, const color&) const;
+  void draw_text_right (float, float, float, std::string_view, const color&) const;
+
+private:
+  //! \brief Implementation class forward declaration
+  class impl;
+
+  //! \brief Implementation pointer
+  std::shared_ptr <impl> impl_;
+};
+
+} // namespace allegropp
+
+#endif
@@ -0,0 +1,159 @@
+#ifndef ALLEGROPP_SPRITE_BATCH
+#define ALLEGROPP_SPRITE_BATCH
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @author      Eduardo Aguiar <aguiar@protonmail.ch>
+// @copyright   Copyright (c) 2025 Eduardo Aguiar
+//
+// This file is part of Allegro++.
+// 
+// Allegro++ is free software: you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+// 
+// You should have received a copy of the GNU Lesser General Public License
+// along with Allegro++. If not, see <https://www.gnu.org/licenses/>.
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+#include <allegropp/atlas.hpp>
+#include <allegropp/bitmap.hpp>
+#include <allegropp/color.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace allegropp
+{
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Batched sprite drawing scope (RAII)
+//! \author Eduardo Aguiar
+//!
+//! Draws are recorded, not issued. When the batch ends (end, or the
+//! destructor), they are sorted by layer and, within a layer, by texture,
+//! then drawn with Allegro's held bitmap drawing, which turns each run of
+//! draws from the same texture (atlas page) into a single draw call. Lower
+//! layers are drawn first. Sprites of the same layer and texture keep their
+//! submission order, but sprites of the same layer and different textures
+//! may be reordered: use layers where overlap order matters, or SUBMISSION.
+//!
+//! Recorded bitmaps are not copied, so they must outlive the batch. Draws
+//! go to the target bitmap, with the transform, current when flushed.
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+class sprite_batch
+{
+public:
+  // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+  // Datatypes
+  // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+  enum sort_mode : std::uint8_t
+  {
+    SORTED = 0,         //!< Sort by layer, then texture
+    SUBMISSION          //!< Keep submission order
+  };
+
+  //! \brief Batching counters, since the batch began
+  struct statistics
+  {
+    std::size_t sprites = 0;            //!< Sprites drawn
+    std::size_t draw_calls = 0;         //!< Runs of sprites drawn at once
+    std::size_t texture_switches = 0;   //!< Runs using another texture than the previous one
+  };
+
+  // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+  // Constructors and destructor
+  // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+  explicit sprite_batch (sort_mode = SORTED, std::size_t = 0);
+  sprite_batch (const sprite_batch&) = delete;
+  ~sprite_batch ();
+
+  // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+  // Operators
+  // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+  sprite_batch& operator= (const sprite_batch&) = delete;
+
+  // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+  //! \brief Record sprite draw
+  //! \param s Sprite
+  //! \param x Left X pos
+  //! \param y Top Y pos
+  //! \param layer Layer
+  //! \param flags Flip flags
+  // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+  void
+  draw (const sprite& s, float x, float y, int layer = 0, int flags = 0)
+  {
+    record (s.get_bitmap ().get_implementation (), s.get_page ().get_implementation (), 0, 0, x, y, WHITE, 0, 1, 1, layer, flags);
+  }
+
+  // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+  //! \brief Record tinted, rotated and scaled sprite draw
+  //! \param s Sprite
+  //! \param x Center X pos
+  //! \param y Center Y pos
+  //! \param tint Tint color
+  //! \param angle Clockwise rotation around the center, in radians
+  //! \param scale_x Horizontal scale
+  //! \param scale_y Vertical scale
+  //! \param layer Layer
+  //! \param flags Flip flags
+  // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+  void
+  draw (const sprite& s, float x, float y, const color& tint, float angle = 0, float scale_x = 1, float scale_y = 1, int layer = 0, int flags = 0)
+  {
+    record (s.get_bitmap ().get_implementation (), s.get_page ().get_implementation (),
+            s.get_width () * 0.5f, s.get_height () * 0.5f, x, y, tint.get_implementation (), angle, scale_x, scale_y, layer, flags);
+  }
+
+  // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+  // Function prototypes
+  // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+  void draw (const bitmap&, float, float, int = 0, int = 0);
+  void draw (const bitmap&, float, float, const color&, float = 0, float = 1, float = 1, int = 0, int = 0);
+  void flush ();
+  statistics end ();
+  const statistics& get_statistics () const noexcept;
+  sort_mode get_sort_mode () const noexcept;
+
+private:
+  //! \brief Recorded draw
+  struct entry
+  {
+    ALLEGRO_BITMAP *bitmap;     //!< Bitmap drawn
+    ALLEGRO_BITMAP *texture;    //!< Parent bitmap, owning the texture
+    float cx, cy;               //!< Pivot, in bitmap coordinates
+    float x, y;                 //!< Pivot destination
+    ALLEGRO_COLOR tint;         //!< Tint color
+    float angle;                //!< Rotation
+    float scale_x, scale_y;     //!< Scale
+    int layer;                  //!< Layer
+    int flags;                  //!< Flip flags
+  };
+
+  static constexpr ALLEGRO_COLOR WHITE = {1.0f, 1.0f, 1.0f, 1.0f};
+
+  // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+  //! \brief Record draw
+  // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+  void
+  record (ALLEGRO_BITMAP *bitmap, ALLEGRO_BITMAP *texture, float cx, float cy, float x, float y,
+          const ALLEGRO_COLOR& tint, float angle, float scale_x, float scale_y, int layer, int flags)
+  {
+    entries_.push_back ({bitmap, texture, cx, cy, x, y, tint, angle, scale_x, scale_y, layer, flags});
+  }
+
+  std::vector <entry> entries_;                 //!< Draws not flushed yet
+  statistics statistics_;                       //!< Counters
+  ALLEGRO_BITMAP *last_texture_ = nullptr;      //!< Texture of the last run
+  sort_mode sort_mode_ = SORTED;                //!< Sort mode
+  bool was_held_ = false;                       //!< Drawing was already held
+  bool is_active_ = true;                       //!< Batch not ended yet
+};
+
+} // namespace allegropp
+
+#endif
@@ -0,0 +1,102 @@
+#ifndef ALLEGROPP_TEXT_CACHE
+#define ALLEGROPP_TEXT_CACHE
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @author      Eduardo Aguiar <aguiar@protonmail.ch>
+// @copyright   Copyright (c) 2025 Eduardo Aguiar
+//
+// This file is part of Allegro++.
+// 
+// Allegro++ is free software: you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+// 
+// You should have received a copy of the GNU Lesser General Public License
+// along with Allegro++. If not, see <https://www.gnu.org/licenses/>.
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+#include <allegropp/color.hpp>
+#include <allegropp/font.hpp>
+#include <cstddef>
+#include <memory>
+#include <string_view>
+
+namespace allegropp
+{
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Cache of measured and rendered text, keyed by font and string
+//! \author Eduardo Aguiar
+//!
+//! Widths are measured once per (font, text). Drawn text is rendered once,
+//! in white, into a bitmap that is then drawn tinted with the text color,
+//! so labels redrawn every frame cost a single bitmap draw instead of
+//! UTF-8 decoding and one quad per glyph. Lookups do not allocate.
+//!
+//! Entries are evicted in LRU order when there are more than a maximum
+//! number of them, or when their bitmaps take more than a byte budget.
+//! Entries hold a reference to their font. Rendering needs a display, so
+//! drawing must happen on the display thread.
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+class text_cache
+{
+public:
+  // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+  // Datatypes
+  // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+  //! \brief Cache counters
+  struct statistics
+  {
+    std::size_t hits = 0;               //!< Lookups served from cache
+    std::size_t misses = 0;             //!< Lookups measuring or rendering text
+    std::size_t evictions = 0;          //!< Entries evicted
+    std::size_t entries = 0;            //!< Entries cached
+    std::size_t bytes = 0;              //!< Bytes of rendered text bitmaps
+
+    //! \brief Get fraction of lookups served from cache (0..1)
+    float
+    get_hit_rate () const noexcept
+    {
+      return hits + misses ? float (hits) / float (hits + misses) : 0.0f;
+    }
+  };
+
+  // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+  // Constructors
+  // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+  explicit text_cache (std::size_t = 1024, std::size_t = 16 << 20);
+  text_cache (text_cache&&) noexcept = default;
+  text_cache (const text_cache&) noexcept = default;
+
+  // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+  // Operators
+  // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+  text_cache& operator= (const text_cache&) noexcept = default;
+  text_cache& operator= (text_cache&&) noexcept = default;
+
+  // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+  // Function prototypes
+  // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+  int get_text_width (const font&, std::string_view);
+  void draw_text_left (const font&, int, int, std::string_view, const color&);
+  void draw_text_center (const font&, int, int, std::string_view, const color&);
+  void draw_text_right (const font&, int, int, std::string_view, const color&);
+  statistics get_statistics () const;
+  void reset_statistics ();
+  void clear ();
+
+private:
+  //! \brief Implementation class forward declaration
+  class impl;
+
+  //! \brief Implementation pointer
+  std::shared_ptr <impl> impl_;
+};
+
+} // namespace allegropp
+
+#endif
@@ -0,0 +1,118 @@
+#ifndef ALLEGROPP_TEXT_LAYOUT
+#define ALLEGROPP_TEXT_LAYOUT
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @author      Eduardo Aguiar <aguiar@protonmail.ch>
+// @copyright   Copyright (c) 2025 Eduardo Aguiar
+//
+// This file is part of Allegro++.
+// 
+// Allegro++ is free software: you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+// 
+// You should have received a copy of the GNU Lesser General Public License
+// along with Allegro++. If not, see <https://www.gnu.org/licenses/>.
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+#include <allegropp/color.hpp>
+#include <allegropp/font.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string_view>
+
+namespace allegropp
+{
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Multi-line UTF-8 text, wrapped to a width
+//! \author Eduardo Aguiar
+//!
+//! Lines are broken at spaces and newlines, measuring each glyph once with
+//! its advance (kerning included), so wrapping is linear in text length.
+//! Words longer than the width are broken between glyphs. Line breaks are
+//! kept until the text, font, width or line limit change.
+//!
+//! Breaking is lazy: drawing a range of rows breaks lines only as far as
+//! the last visible one, and append_text re-breaks only the last
+//! paragraph, so scrolling logs stay cheap. get_line_count and get_height
+//! break the whole text.
+//!
+//! Lines are drawn with held bitmap drawing, so glyphs sharing a font page
+//! are sent to the GPU in a single draw call.
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+class text_layout
+{
+public:
+  // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+  // Datatypes
+  // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+  enum alignment : std::uint8_t
+  {
+    LEFT = 0,           //!< Lines start at the left edge
+    CENTER,             //!< Lines are centered
+    RIGHT,              //!< Lines end at the right edge
+    JUSTIFY             //!< Lines fill the width, except paragraph last lines
+  };
+
+  //! \brief Laid out line
+  struct line
+  {
+    std::string_view text;              //!< Line text, without trailing spaces
+    int x = 0;                          //!< Left X pos, relative to the layout
+    int y = 0;                          //!< Top Y pos, relative to the layout
+    int width = 0;                      //!< Width in pixels, ellipsis included
+    bool is_ellipsized = false;         //!< Text continues past this line
+  };
+
+  // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+  // Constructors
+  // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+  text_layout (const font&, int, alignment = LEFT);
+  text_layout (const font&, std::string_view, int, alignment = LEFT);
+  text_layout (text_layout&&) noexcept = default;
+  text_layout (const text_layout&) noexcept = default;
+
+  // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+  // Operators
+  // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+  text_layout& operator= (const text_layout&) noexcept = default;
+  text_layout& operator= (text_layout&&) noexcept = default;
+
+  // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+  // Function prototypes
+  // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+  void set_font (const font&);
+  void set_text (std::string_view);
+  void append_text (std::string_view);
+  void set_width (int);
+  void set_alignment (alignment);
+  void set_max_lines (std::size_t);
+  font get_font () const;
+  std::string_view get_text () const;
+  int get_width () const;
+  alignment get_alignment () const;
+  std::size_t get_max_lines () const;
+  int get_line_height () const;
+  std::size_t get_line_count () const;
+  int get_height () const;
+  line get_line (std::size_t) const;
+  void draw (int, int, const color&) const;
+  void draw (int, int, const color&, int, int) const;
+
+private:
+  //! \brief Implementation class forward declaration
+  class impl;
+
+  //! \brief Implementation pointer
+  std::shared_ptr <impl> impl_;
+};
+
+} // namespace allegropp
+
+#endif
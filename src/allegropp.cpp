@@ -19,6 +19,7 @@
 // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
 #include <allegropp/allegropp.hpp>
 #include <allegro5/allegro.h>
+#include <allegro5/allegro_image.h>
 #include <allegro5/allegro_primitives.h>
 #include <mutex>
 #include <stdexcept>
@@ -26,6 +27,7 @@
 namespace
 {
 std::once_flag is_initialized_;
+std::once_flag is_image_initialized_;
 
 // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
 //! \brief Initialize Allegro main system and primitives_addon
@@ -39,6 +41,16 @@ _init ()
   al_init_primitives_addon ();
 }
 
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Initialize Allegro main system and image_addon
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+static void
+_init_image ()
+{
+  allegropp::init ();
+  al_init_image_addon ();
+}
+
 } // namespace
 
 namespace allegropp
@@ -52,4 +64,16 @@ init ()
   std::call_once (is_initialized_, _init);
 }
 
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Initialize Allegro main system and image subsystem
+//!
+//! Shared by every module loading images, as al_init_image_addon must not
+//! run twice concurrently.
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+void
+init_image ()
+{
+  std::call_once (is_image_initialized_, _init_image);
+}
+
 } // namespace allegropp
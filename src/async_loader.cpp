@@ -0,0 +1,763 @@
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @author      Eduardo Aguiar <aguiar@protonmail.ch>
+// @copyright   Copyright (c) 2025 Eduardo Aguiar
+//
+// This file is part of Allegro++.
+// 
+// Allegro++ is free software: you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+// 
+// You should have received a copy of the GNU Lesser General Public License
+// along with Allegro++. If not, see <https://www.gnu.org/licenses/>.
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+#include <allegropp/async_loader.hpp>
+#include <allegro5/allegro.h>
+#include <atomic>
+#include <condition_variable>
+#include <cstring>
+#include <deque>
+#include <exception>
+#include <fstream>
+#include <functional>
+#include <mutex>
+#include <queue>
+#include <stdexcept>
+#include <thread>
+#include <variant>
+#include <vector>
+
+namespace
+{
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Check if a font file holds a readable non outline font
+//! \param path Font path
+//! \return true if path opens and is not a TrueType, OpenType or Type 1 font
+//!
+//! Image and baked fonts create their glyph bitmaps when loaded, so they must
+//! be loaded on the display thread. Outline fonts render glyphs when drawn.
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+static bool
+_is_bitmap_font (const std::string& path)
+{
+  std::ifstream in (path, std::ios::binary);
+  char magic[4] = {};
+
+  if (!in.read (magic, sizeof (magic)))
+    return false;
+
+  return std::memcmp (magic, "\0\1\0\0", 4) != 0 &&
+         std::memcmp (magic, "OTTO", 4) != 0 &&
+         std::memcmp (magic, "true", 4) != 0 &&
+         std::memcmp (magic, "ttcf", 4) != 0 &&
+         std::memcmp (magic, "typ1", 4) != 0 &&
+         std::memcmp (magic, "\x80\x01", 2) != 0 &&
+         std::memcmp (magic, "%!", 2) != 0;
+}
+
+} // namespace
+
+
+namespace allegropp
+{
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Progress counters, shared by the loader and its tasks
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+struct async_loader_counters
+{
+  std::atomic <std::size_t> requested {0};
+  std::atomic <std::size_t> decoded {0};
+  std::atomic <std::size_t> finished {0};
+  std::atomic <std::size_t> failed {0};
+};
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Load request
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+class async_loader::task
+{
+public:
+  using value_type = std::variant <std::monostate, bitmap, font, sample>;
+  using decoder_type = std::function <value_type ()>;
+  using finalizer_type = std::function <void (value_type&)>;
+
+  task (const std::string&, int, std::uint64_t, decoder_type, finalizer_type, const std::shared_ptr <async_loader_counters>&);
+
+  void run ();
+  bool finalize ();
+  bool cancel ();
+  void wait ();
+  const value_type& get_value () const;
+
+  //! \brief Get path
+  const std::string& get_path () const noexcept { return path_; }
+
+  //! \brief Get priority
+  int get_priority () const noexcept { return priority_; }
+
+  //! \brief Get submission sequence number
+  std::uint64_t get_sequence () const noexcept { return sequence_; }
+
+  //! \brief Get status
+  status
+  get_status () const
+  {
+    std::lock_guard <std::mutex> lock (mutex_);
+    return status_;
+  }
+
+private:
+  void finish (status);
+
+  const std::string path_;                              //!< File path
+  const int priority_;                                  //!< Priority
+  const std::uint64_t sequence_;                        //!< Submission order
+  decoder_type decoder_;                                //!< Worker step
+  finalizer_type finalizer_;                            //!< Display thread step, if any
+  std::shared_ptr <async_loader_counters> counters_;    //!< Loader counters
+  mutable std::mutex mutex_;                            //!< Guards the fields below
+  std::condition_variable done_;                        //!< Status changed
+  status status_ = QUEUED;                              //!< Status
+  value_type value_;                                    //!< Resource
+  std::exception_ptr error_;                            //!< Load error
+};
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Constructor
+//! \param path File path
+//! \param priority Priority. Higher priorities are decoded first
+//! \param sequence Submission order, for requests of the same priority
+//! \param decoder Function decoding the resource, run on a worker
+//! \param finalizer Function finalizing the resource, or nullptr
+//! \param counters Loader counters
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+async_loader::task::task (
+  const std::string& path,
+  int priority,
+  std::uint64_t sequence,
+  decoder_type decoder,
+  finalizer_type finalizer,
+  const std::shared_ptr <async_loader_counters>& counters)
+  : path_ (path),
+    priority_ (priority),
+    sequence_ (sequence),
+    decoder_ (std::move (decoder)),
+    finalizer_ (std::move (finalizer)),
+    counters_ (counters)
+{
+  counters_->requested++;
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Decode resource. Called on a worker thread
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+void
+async_loader::task::run ()
+{
+  {
+    std::lock_guard <std::mutex> lock (mutex_);
+
+    if (status_ != QUEUED)
+      return;
+
+    status_ = DECODING;
+  }
+
+  value_type value;
+  std::exception_ptr error;
+
+  try
+    {
+      value = decoder_ ();
+    }
+  catch (...)
+    {
+      error = std::current_exception ();
+    }
+
+  decoder_ = nullptr;
+
+  std::lock_guard <std::mutex> lock (mutex_);
+  value_ = std::move (value);
+  error_ = error;
+
+  if (error)
+    finish (FAILED);
+
+  else if (finalizer_)
+    {
+      status_ = DECODED;
+      counters_->decoded++;
+      done_.notify_all ();
+    }
+
+  else
+    finish (READY);
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Finalize decoded resource. Called on the display thread
+//! \return true if finalized now, false if not decoded or already finalized
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+bool
+async_loader::task::finalize ()
+{
+  std::lock_guard <std::mutex> lock (mutex_);
+
+  if (status_ != DECODED)
+    return false;
+
+  counters_->decoded--;
+
+  try
+    {
+      finalizer_ (value_);
+      finish (READY);
+    }
+  catch (...)
+    {
+      error_ = std::current_exception ();
+      finish (FAILED);
+    }
+
+  return true;
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Cancel request, if not being decoded yet
+//! \return true if cancelled
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+bool
+async_loader::task::cancel ()
+{
+  std::lock_guard <std::mutex> lock (mutex_);
+
+  if (status_ != QUEUED)
+    return false;
+
+  decoder_ = nullptr;
+  error_ = std::make_exception_ptr (std::runtime_error ("load cancelled: " + path_));
+  finish (FAILED);
+
+  return true;
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Wait until resource is decoded, and finalize it if needed
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+void
+async_loader::task::wait ()
+{
+  {
+    std::unique_lock <std::mutex> lock (mutex_);
+    done_.wait (lock, [this]{ return status_ >= DECODED; });
+  }
+
+  finalize ();
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Get resource
+//! \return Resource, once finished
+//! \throws Load error, if the request failed
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+const async_loader::task::value_type&
+async_loader::task::get_value () const
+{
+  std::lock_guard <std::mutex> lock (mutex_);
+
+  if (error_)
+    std::rethrow_exception (error_);
+
+  return value_;
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Set final status. Called with mutex locked
+//! \param s READY or FAILED
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+void
+async_loader::task::finish (status s)
+{
+  status_ = s;
+
+  if (s == FAILED)
+    counters_->failed++;
+
+  counters_->finished++;
+  done_.notify_all ();
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief <i>async_loader</i> implementation class
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+class async_loader::impl
+{
+public:
+  // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+  // Constructors and destructor
+  // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+  explicit impl (unsigned int);
+  impl (const impl&) = delete;
+  impl (impl&&) = delete;
+  ~impl ();
+
+  // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+  // Operators
+  // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+  impl& operator= (const impl&) = delete;
+  impl& operator= (impl&&) = delete;
+
+  // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+  // Prototypes
+  // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+  std::shared_ptr <task> submit (const std::string&, int, task::decoder_type, task::finalizer_type);
+  std::size_t finalize (std::size_t);
+  void cancel ();
+  progress get_progress () const;
+
+private:
+  void worker ();
+
+  //! \brief Queue order: higher priority first, then submission order
+  struct task_order
+  {
+    bool
+    operator() (const std::shared_ptr <task>& a, const std::shared_ptr <task>& b) const noexcept
+    {
+      if (a->get_priority () != b->get_priority ())
+        return a->get_priority () < b->get_priority ();
+
+      return a->get_sequence () > b->get_sequence ();
+    }
+  };
+
+  using queue_type = std::priority_queue <std::shared_ptr <task>, std::vector <std::shared_ptr <task>>, task_order>;
+
+  std::mutex queue_mutex_;                              //!< Guards queue_, sequence_ and stop_
+  std::condition_variable queue_ready_;                 //!< Queue not empty, or stopping
+  queue_type queue_;                                    //!< Requests waiting for a worker
+  std::uint64_t sequence_ = 0;                          //!< Next sequence number
+  bool stop_ = false;                                   //!< Workers must stop
+
+  std::mutex decoded_mutex_;                            //!< Guards decoded_
+  std::deque <std::shared_ptr <task>> decoded_;         //!< Requests waiting for finalize
+
+  std::shared_ptr <async_loader_counters> counters_;    //!< Progress counters
+  std::vector <std::thread> workers_;                   //!< Worker threads
+};
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Constructor
+//! \param threads Number of worker threads
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+async_loader::impl::impl (unsigned int threads)
+  : counters_ (std::make_shared <async_loader_counters> ())
+{
+  if (threads < 1)
+    throw std::invalid_argument ("invalid loader thread count");
+
+  for (unsigned int i = 0; i < threads; i++)
+    workers_.emplace_back (&impl::worker, this);
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Destructor
+//!
+//! Requests still queued are cancelled; requests being decoded are finished.
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+async_loader::impl::~impl ()
+{
+  cancel ();
+
+  {
+    std::lock_guard <std::mutex> lock (queue_mutex_);
+    stop_ = true;
+  }
+
+  queue_ready_.notify_all ();
+
+  for (auto& t : workers_)
+    t.join ();
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Submit request
+//! \param path File path
+//! \param priority Priority
+//! \param decoder Decoding function
+//! \param finalizer Finalizing function, or nullptr
+//! \return Request
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+std::shared_ptr <async_loader::task>
+async_loader::impl::submit (const std::string& path, int priority, task::decoder_type decoder, task::finalizer_type finalizer)
+{
+  std::shared_ptr <task> t;
+
+  {
+    std::lock_guard <std::mutex> lock (queue_mutex_);
+    t = std::make_shared <task> (path, priority, sequence_++, std::move (decoder), std::move (finalizer), counters_);
+    queue_.push (t);
+  }
+
+  queue_ready_.notify_one ();
+
+  return t;
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Finalize decoded requests, oldest first
+//! \param max_count Maximum number of requests to finalize
+//! \return Number of requests finalized
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+std::size_t
+async_loader::impl::finalize (std::size_t max_count)
+{
+  std::size_t count = 0;
+
+  while (count < max_count)
+    {
+      std::shared_ptr <task> t;
+
+      {
+        std::lock_guard <std::mutex> lock (decoded_mutex_);
+
+        if (decoded_.empty ())
+          break;
+
+        t = std::move (decoded_.front ());
+        decoded_.pop_front ();
+      }
+
+      // Requests may have been finalized already, by handle::get
+      if (t->finalize ())
+        count++;
+    }
+
+  return count;
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Cancel queued requests
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+void
+async_loader::impl::cancel ()
+{
+  queue_type queue;
+
+  {
+    std::lock_guard <std::mutex> lock (queue_mutex_);
+    std::swap (queue, queue_);
+  }
+
+  for (; !queue.empty (); queue.pop ())
+    queue.top ()->cancel ();
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Get progress
+//! \return Progress counters
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+async_loader::progress
+async_loader::impl::get_progress () const
+{
+  progress p;
+
+  // Read finished first, so it never exceeds requested
+  p.finished = counters_->finished;
+  p.failed = counters_->failed;
+  p.decoded = counters_->decoded;
+  p.requested = counters_->requested;
+
+  return p;
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Worker thread loop
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+void
+async_loader::impl::worker ()
+{
+  for (;;)
+    {
+      std::shared_ptr <task> t;
+
+      {
+        std::unique_lock <std::mutex> lock (queue_mutex_);
+        queue_ready_.wait (lock, [this]{ return stop_ || !queue_.empty (); });
+
+        if (stop_)
+          return;
+
+        t = queue_.top ();
+        queue_.pop ();
+      }
+
+      t->run ();
+
+      if (t->get_status () == DECODED)
+        {
+          std::lock_guard <std::mutex> lock (decoded_mutex_);
+          decoded_.push_back (std::move (t));
+        }
+    }
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Constructor
+//! \param t Load request
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+async_loader::handle_base::handle_base (const std::shared_ptr <task>& t)
+  : task_ (t)
+{
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Get request status
+//! \return Status
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+async_loader::status
+async_loader::handle_base::get_status () const
+{
+  if (!task_)
+    throw std::invalid_argument ("null load handle");
+
+  return task_->get_status ();
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Check if request is finished
+//! \return true if READY or FAILED
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+bool
+async_loader::handle_base::is_done () const
+{
+  return get_status () >= READY;
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Get request priority
+//! \return Priority
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+int
+async_loader::handle_base::get_priority () const
+{
+  if (!task_)
+    throw std::invalid_argument ("null load handle");
+
+  return task_->get_priority ();
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Get request path
+//! \return File path
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+const std::string&
+async_loader::handle_base::get_path () const
+{
+  if (!task_)
+    throw std::invalid_argument ("null load handle");
+
+  return task_->get_path ();
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Wait until request is finished, finalizing it on this thread
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+void
+async_loader::handle_base::wait () const
+{
+  if (!task_)
+    throw std::invalid_argument ("null load handle");
+
+  task_->wait ();
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Operator bool
+//! \return true if handle refers to a request
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+async_loader::handle_base::operator bool () const noexcept
+{
+  return bool (task_);
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Get bitmap
+//! \return Bitmap, once finished
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+template <>
+bitmap
+async_loader::handle <bitmap>::get () const
+{
+  wait ();
+  return std::get <bitmap> (task_->get_value ());
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Get font
+//! \return Font, once finished
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+template <>
+font
+async_loader::handle <font>::get () const
+{
+  wait ();
+  return std::get <font> (task_->get_value ());
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Get sample
+//! \return Sample, once finished
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+template <>
+sample
+async_loader::handle <sample>::get () const
+{
+  wait ();
+  return std::get <sample> (task_->get_value ());
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Constructor
+//! \param threads Number of worker threads
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+async_loader::async_loader (unsigned int threads)
+  : impl_ (std::make_shared <impl> (threads))
+{
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Load bitmap
+//! \param path Bitmap file path
+//! \param priority Priority. Higher priorities are decoded first
+//! \return Handle
+//!
+//! The bitmap is decoded into a memory bitmap, then converted by finalize
+//! according to the display thread's new bitmap flags.
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+async_loader::handle <bitmap>
+async_loader::load_bitmap (const std::string& path, int priority)
+{
+  auto decoder = [path]() -> task::value_type
+  {
+    const int flags = al_get_new_bitmap_flags ();
+    al_set_new_bitmap_flags (ALLEGRO_MEMORY_BITMAP);
+    bitmap b (path);
+    al_set_new_bitmap_flags (flags);
+
+    if (!b)
+      throw std::runtime_error ("cannot load bitmap: " + path);
+
+    return b;
+  };
+
+  auto finalizer = [](task::value_type& value)
+  {
+    al_convert_bitmap (std::get <bitmap> (value).get_implementation ());
+  };
+
+  return handle <bitmap> (impl_->submit (path, priority, decoder, finalizer));
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Load font
+//! \param path Font path
+//! \param size Font size
+//! \param priority Priority. Higher priorities are decoded first
+//! \return Handle
+//!
+//! Outline font glyphs are rendered when first drawn, on the drawing thread.
+//! Other fonts create their glyph bitmaps when loaded, and Allegro has no
+//! public way to reach them to convert, so finalize loads them instead.
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+async_loader::handle <font>
+async_loader::load_font (const std::string& path, std::size_t size, int priority)
+{
+  auto load = [path, size]
+  {
+    font f (path, size);
+
+    if (!f)
+      throw std::runtime_error ("cannot load font: " + path);
+
+    return f;
+  };
+
+  auto decoder = [path, load]() -> task::value_type
+  {
+    if (_is_bitmap_font (path))
+      return std::monostate ();
+
+    return load ();
+  };
+
+  auto finalizer = [load](task::value_type& value)
+  {
+    if (std::holds_alternative <std::monostate> (value))
+      value = load ();
+  };
+
+  return handle <font> (impl_->submit (path, priority, decoder, finalizer));
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Load audio sample
+//! \param path Sample file path
+//! \param priority Priority. Higher priorities are decoded first
+//! \return Handle. Samples are ready once decoded
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+async_loader::handle <sample>
+async_loader::load_sample (const std::string& path, int priority)
+{
+  auto decoder = [path]() -> task::value_type
+  {
+    sample s (path);
+
+    if (!s)
+      throw std::runtime_error ("cannot load sample: " + path);
+
+    return s;
+  };
+
+  return handle <sample> (impl_->submit (path, priority, decoder, nullptr));
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Finalize decoded resources. Call on the display thread
+//! \param max_count Maximum number of resources to finalize, to bound the
+//!        time spent per frame
+//! \return Number of resources finalized
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+std::size_t
+async_loader::finalize (std::size_t max_count)
+{
+  return impl_->finalize (max_count);
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Cancel requests not being decoded yet. They become FAILED
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+void
+async_loader::cancel ()
+{
+  impl_->cancel ();
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Get progress
+//! \return Progress counters
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+async_loader::progress
+async_loader::get_progress () const
+{
+  return impl_->get_progress ();
+}
+
+} // namespace allegropp
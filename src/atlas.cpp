@@ -0,0 +1,1024 @@
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @author      Eduardo Aguiar <aguiar@protonmail.ch>
+// @copyright   Copyright (c) 2025 Eduardo Aguiar
+//
+// This file is part of Allegro++.
+// 
+// Allegro++ is free software: you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+// 
+// You should have received a copy of the GNU Lesser General Public License
+// along with Allegro++. If not, see <https://www.gnu.org/licenses/>.
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+#include <allegropp/atlas.hpp>
+#include <allegropp/bitmap_lock.hpp>
+#include "parallel_for.hpp"
+#include <algorithm>
+#include <climits>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <stdexcept>
+#include <unordered_map>
+#include <vector>
+
+namespace
+{
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// Constants
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+constexpr char MAGIC[8] = {'A', 'L', 'P', 'P', 'A', 'T', 'L', 'S'};
+constexpr std::uint32_t ORDER_MARK = 0x01020304;
+constexpr std::uint32_t VERSION = 1;
+
+// Pages are uploaded and saved in this format, whose words read 0xAABBGGRR
+// on little and big endian machines alike
+constexpr int PIXEL_FORMAT = ALLEGRO_PIXEL_FORMAT_ABGR_8888_LE;
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Skyline bottom-left rectangle packer
+//!
+//! The packed area is described by its top outline, a list of horizontal
+//! segments. Each rectangle goes where its top edge ends lowest, ties broken
+//! by the narrowest segment, which keeps the outline flat.
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+class skyline
+{
+public:
+  // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+  //! \brief Constructor
+  //! \param width Area width
+  //! \param height Area height
+  // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+  skyline (int width, int height)
+    : width_ (width),
+      height_ (height),
+      segments_ {{0, 0, width}}
+  {
+  }
+
+  // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+  //! \brief Insert rectangle
+  //! \param width Rectangle width
+  //! \param height Rectangle height
+  //! \param x Left column, if inserted
+  //! \param y Top row, if inserted
+  //! \return true if rectangle fits, false otherwise
+  // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+  bool
+  insert (int width, int height, int& x, int& y)
+  {
+    std::size_t best = segments_.size ();
+    int best_top = INT_MAX;
+    int best_width = INT_MAX;
+
+    for (std::size_t i = 0; i < segments_.size (); i++)
+      {
+        const int top = fit (i, width, height);
+
+        if (top >= 0 && (top + height < best_top || (top + height == best_top && segments_[i].width < best_width)))
+          {
+            best = i;
+            best_top = top + height;
+            best_width = segments_[i].width;
+          }
+      }
+
+    if (best == segments_.size ())
+      return false;
+
+    x = segments_[best].x;
+    y = best_top - height;
+
+    // Raise outline over the new rectangle
+    segments_.insert (segments_.begin () + best, {x, best_top, width});
+
+    for (std::size_t i = best + 1; i < segments_.size (); )
+      {
+        const int overlap = segments_[i - 1].x + segments_[i - 1].width - segments_[i].x;
+
+        if (overlap <= 0)
+          break;
+
+        segments_[i].x += overlap;
+        segments_[i].width -= overlap;
+
+        if (segments_[i].width <= 0)
+          segments_.erase (segments_.begin () + i);
+
+        else
+          break;
+      }
+
+    // Merge neighbours of the same height
+    for (std::size_t i = 1; i < segments_.size (); )
+      {
+        if (segments_[i - 1].y == segments_[i].y)
+          {
+            segments_[i - 1].width += segments_[i].width;
+            segments_.erase (segments_.begin () + i);
+          }
+
+        else
+          i++;
+      }
+
+    return true;
+  }
+
+private:
+  // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+  //! \brief Find row where a rectangle rests, starting at a segment
+  //! \param i Segment index
+  //! \param width Rectangle width
+  //! \param height Rectangle height
+  //! \return Top row, or -1 if the rectangle does not fit there
+  // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+  int
+  fit (std::size_t i, int width, int height) const
+  {
+    if (segments_[i].x + width > width_)
+      return -1;
+
+    int y = 0;
+
+    for (int left = width; left > 0; i++)
+      {
+        y = std::max (y, segments_[i].y);
+
+        if (y + height > height_)
+          return -1;
+
+        left -= segments_[i].width;
+      }
+
+    return y;
+  }
+
+  //! \brief Outline segment
+  struct segment
+  {
+    int x;          //!< Left column
+    int y;          //!< Top of the packed area below it
+    int width;      //!< Width
+  };
+
+  int width_;                           //!< Area width
+  int height_;                          //!< Area height
+  std::vector <segment> segments_;      //!< Outline, left to right
+};
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief FNV-1a hash, fed incrementally
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+class hasher
+{
+public:
+  void
+  update (const void *data, std::size_t size)
+  {
+    auto p = static_cast <const unsigned char *> (data);
+
+    for (std::size_t i = 0; i < size; i++)
+      value_ = (value_ ^ p[i]) * 0x100000001b3ULL;
+  }
+
+  void
+  update (std::uint64_t v)
+  {
+    update (&v, sizeof (v));
+  }
+
+  void
+  update (const std::string& s)
+  {
+    update (s.size ());
+    update (s.data (), s.size ());
+  }
+
+  std::uint64_t
+  get_value () const noexcept
+  {
+    return value_;
+  }
+
+private:
+  std::uint64_t value_ = 0xcbf29ce484222325ULL;
+};
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Get page file path
+//! \param path Manifest path
+//! \param page Page index
+//! \return Page path
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+std::string
+get_page_path (const std::string& path, std::size_t page)
+{
+  return path + '.' + std::to_string (page) + ".png";
+}
+
+} // namespace
+
+namespace allegropp
+{
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief <i>atlas</i> implementation class
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+class atlas::impl
+{
+public:
+  impl (int, int, int, int, unsigned int);
+
+  void add (const std::string&, const std::string&);
+  void add (const std::string&, const bitmap&);
+  void build ();
+  bool load (const std::string&);
+  void save (const std::string&) const;
+  bool has_sprite (const std::string&) const;
+  sprite get_sprite (const std::string&) const;
+  std::size_t get_sprite_count () const;
+  std::size_t get_page_count () const;
+  bitmap get_page (std::size_t) const;
+
+private:
+  //! \brief Input image
+  struct image
+  {
+    std::string name;                   //!< Sprite name
+    std::string path;                   //!< File path, empty for bitmaps
+    int width = 0;                      //!< Width in pixels
+    int height = 0;                     //!< Height in pixels
+    std::vector <std::uint32_t> pixels; //!< Pixels, while needed
+    std::size_t page = 0;               //!< Page index
+    int x = 0;                          //!< Left column on page
+    int y = 0;                          //!< Top row on page
+  };
+
+  void add_image (image&&);
+  void load_images ();
+  std::size_t pack ();
+  void make_sprites ();
+  std::uint64_t get_key () const;
+
+  int page_width_;                                      //!< Page width
+  int page_height_;                                     //!< Page height
+  int padding_;                                         //!< Transparent gap
+  int extrude_;                                         //!< Edge repetitions
+  unsigned int threads_;                                //!< Worker threads
+  std::vector <image> images_;                          //!< Input images
+  std::unordered_map <std::string, std::size_t> names_; //!< Name -> image
+  std::vector <bitmap> pages_;                          //!< Atlas pages
+  std::vector <sprite> sprites_;                        //!< Sprites, as images_
+};
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Constructor
+//! \param page_width Page width in pixels
+//! \param page_height Page height in pixels
+//! \param padding Transparent pixels between images
+//! \param extrude Times edge pixels are repeated around each image
+//! \param threads Worker threads, including the calling one
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+atlas::impl::impl (int page_width, int page_height, int padding, int extrude, unsigned int threads)
+  : page_width_ (page_width),
+    page_height_ (page_height),
+    padding_ (padding),
+    extrude_ (extrude),
+    threads_ (threads)
+{
+  if (page_width < 1 || page_height < 1)
+    throw std::invalid_argument ("invalid atlas page size");
+
+  if (padding < 0 || extrude < 0)
+    throw std::invalid_argument ("invalid atlas padding");
+
+  if (threads < 1)
+    throw std::invalid_argument ("invalid atlas thread count");
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Add image file
+//! \param name Sprite name
+//! \param path Image file path, decoded by build
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+void
+atlas::impl::add (const std::string& name, const std::string& path)
+{
+  if (path.empty ())
+    throw std::invalid_argument ("empty atlas image path");
+
+  image img;
+  img.name = name;
+  img.path = path;
+
+  add_image (std::move (img));
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Add bitmap
+//! \param name Sprite name
+//! \param b Bitmap. Its pixels are copied, so it can be modified afterwards
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+void
+atlas::impl::add (const std::string& name, const bitmap& b)
+{
+  auto lock = b.lock (PIXEL_FORMAT, bitmap::READ_ONLY);
+  auto src = lock.get_span <const std::uint32_t> ();
+
+  if (src.get_width () < 1 || src.get_height () < 1)
+    throw std::invalid_argument ("empty atlas image: " + name);
+
+  image img;
+  img.name = name;
+  img.width = src.get_width ();
+  img.height = src.get_height ();
+  img.pixels.resize (std::size_t (img.width) * img.height);
+
+  copy (src, pixel_span <std::uint32_t> (img.pixels.data (), img.width, img.height, img.width * 4));
+
+  add_image (std::move (img));
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Add input image
+//! \param img Image
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+void
+atlas::impl::add_image (image&& img)
+{
+  if (!names_.emplace (img.name, images_.size ()).second)
+    throw std::invalid_argument ("duplicate atlas sprite name: " + img.name);
+
+  images_.push_back (std::move (img));
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Build atlas
+//!
+//! Decodes image files, packs all images and composes the pages on worker
+//! threads, then uploads each page with a single write-only lock.
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+void
+atlas::impl::build ()
+{
+  load_images ();
+
+  const std::size_t page_count = pack ();
+
+  // Compose pages into memory, repeating the edges of each image
+  std::vector <std::vector <std::uint32_t>> buffers (page_count);
+
+  for (auto& buffer : buffers)
+    buffer.assign (std::size_t (page_width_) * page_height_, 0);
+
+  parallel_for (threads_, images_.size (), [&](std::size_t i)
+  {
+    const image& img = images_[i];
+    std::uint32_t *page = buffers[img.page].data ();
+
+    for (int y = -extrude_; y < img.height + extrude_; y++)
+      {
+        const std::uint32_t *src = img.pixels.data () + std::size_t (std::clamp (y, 0, img.height - 1)) * img.width;
+        std::uint32_t *dst = page + std::size_t (img.y + y) * page_width_ + img.x;
+
+        std::fill (dst - extrude_, dst, src[0]);
+        std::memcpy (dst, src, std::size_t (img.width) * 4);
+        std::fill (dst + img.width, dst + img.width + extrude_, src[img.width - 1]);
+      }
+  });
+
+  // Upload pages
+  std::vector <bitmap> pages;
+
+  for (std::size_t i = 0; i < page_count; i++)
+    {
+      pages.emplace_back (page_width_, page_height_);
+
+      if (!pages[i])
+        throw std::runtime_error ("cannot create atlas page");
+
+      auto lock = pages[i].lock (PIXEL_FORMAT, bitmap::WRITE_ONLY);
+      copy (pixel_span <const std::uint32_t> (buffers[i].data (), page_width_, page_height_, page_width_ * 4),
+            lock.get_span <std::uint32_t> ());
+    }
+
+  pages_ = std::move (pages);
+  make_sprites ();
+
+  // Release decoded files. Bitmap pixels are kept, for rebuilds
+  for (auto& img : images_)
+    if (!img.path.empty ())
+      {
+        img.pixels.clear ();
+        img.pixels.shrink_to_fit ();
+      }
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Decode image files not decoded yet, on worker threads
+//!
+//! Files are loaded as memory bitmaps, so no display is needed by workers.
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+void
+atlas::impl::load_images ()
+{
+  std::vector <std::size_t> pending;
+
+  for (std::size_t i = 0; i < images_.size (); i++)
+    if (!images_[i].path.empty () && images_[i].pixels.empty ())
+      pending.push_back (i);
+
+  parallel_for (threads_, pending.size (), [&](std::size_t i)
+  {
+    image& img = images_[pending[i]];
+
+    const int flags = al_get_new_bitmap_flags ();
+    al_set_new_bitmap_flags (ALLEGRO_MEMORY_BITMAP);
+    bitmap b (img.path);
+    al_set_new_bitmap_flags (flags);
+
+    if (!b || b.get_width () < 1 || b.get_height () < 1)
+      throw std::runtime_error ("cannot load atlas image: " + img.path);
+
+    auto lock = b.lock (PIXEL_FORMAT, bitmap::READ_ONLY);
+    auto src = lock.get_span <const std::uint32_t> ();
+
+    img.width = src.get_width ();
+    img.height = src.get_height ();
+    img.pixels.resize (std::size_t (img.width) * img.height);
+
+    copy (src, pixel_span <std::uint32_t> (img.pixels.data (), img.width, img.height, img.width * 4));
+  });
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Assign page and position to every image
+//! \return Number of pages
+//!
+//! Images are packed tallest first, each into the first page it fits.
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+std::size_t
+atlas::impl::pack ()
+{
+  std::vector <std::size_t> order (images_.size ());
+
+  for (std::size_t i = 0; i < order.size (); i++)
+    order[i] = i;
+
+  std::stable_sort (order.begin (), order.end (), [this](std::size_t a, std::size_t b)
+  {
+    if (images_[a].height != images_[b].height)
+      return images_[a].height > images_[b].height;
+
+    return images_[a].width > images_[b].width;
+  });
+
+  std::vector <skyline> pages;
+
+  for (std::size_t i : order)
+    {
+      image& img = images_[i];
+      const int cell_width = img.width + 2 * extrude_ + padding_;
+      const int cell_height = img.height + 2 * extrude_ + padding_;
+
+      if (cell_width > page_width_ || cell_height > page_height_)
+        throw std::invalid_argument ("atlas image larger than page: " + img.name);
+
+      std::size_t page = 0;
+      int x = 0;
+      int y = 0;
+
+      while (page < pages.size () && !pages[page].insert (cell_width, cell_height, x, y))
+        page++;
+
+      if (page == pages.size ())
+        {
+          pages.emplace_back (page_width_, page_height_);
+          pages.back ().insert (cell_width, cell_height, x, y);
+        }
+
+      img.page = page;
+      img.x = x + extrude_;
+      img.y = y + extrude_;
+    }
+
+  return pages.size ();
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Create sprites from image placements
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+void
+atlas::impl::make_sprites ()
+{
+  sprites_.clear ();
+  sprites_.reserve (images_.size ());
+
+  for (const auto& img : images_)
+    sprites_.emplace_back (pages_[img.page], img.x, img.y, img.width, img.height);
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Get cache key
+//! \return Hash of the options and inputs
+//!
+//! Files are identified by path, size and modification time, so computing
+//! the key does not decode them. Bitmaps are identified by their pixels.
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+std::uint64_t
+atlas::impl::get_key () const
+{
+  hasher h;
+
+  h.update (VERSION);
+  h.update (std::uint64_t (page_width_));
+  h.update (std::uint64_t (page_height_));
+  h.update (std::uint64_t (padding_));
+  h.update (std::uint64_t (extrude_));
+
+  for (const auto& img : images_)
+    {
+      h.update (img.name);
+      h.update (img.path);
+
+      if (img.path.empty ())
+        {
+          h.update (std::uint64_t (img.width));
+          h.update (std::uint64_t (img.height));
+          h.update (img.pixels.data (), img.pixels.size () * 4);
+        }
+
+      else
+        {
+          std::error_code ec;
+          const auto size = std::filesystem::file_size (img.path, ec);
+          h.update (ec ? 0 : std::uint64_t (size));
+
+          const auto time = std::filesystem::last_write_time (img.path, ec);
+          h.update (ec ? 0 : std::uint64_t (time.time_since_epoch ().count ()));
+        }
+    }
+
+  return h.get_value ();
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Load atlas saved by save
+//! \param path Manifest path
+//! \return true if loaded, false if missing, invalid or out of date
+//!
+//! Image files are not decoded: only the saved pages are loaded.
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+bool
+atlas::impl::load (const std::string& path)
+{
+  std::ifstream in (path, std::ios::binary);
+
+  if (!in)
+    return false;
+
+  auto read = [&](std::uint32_t& value)
+  {
+    return bool (in.read (reinterpret_cast <char *> (&value), 4));
+  };
+
+  // Header
+  char magic[sizeof (MAGIC)];
+  std::uint32_t order_mark, version, page_count, sprite_count;
+  std::uint64_t key;
+
+  in.read (magic, sizeof (magic));
+  in.read (reinterpret_cast <char *> (&key), sizeof (key));
+
+  if (!in || std::memcmp (magic, MAGIC, sizeof (MAGIC)) != 0)
+    return false;
+
+  if (!read (order_mark) || !read (version) || !read (page_count) || !read (sprite_count))
+    return false;
+
+  if (order_mark != ORDER_MARK || version != VERSION || key != get_key () || sprite_count != images_.size ())
+    return false;
+
+  // Sprites
+  std::vector <image> placed (images_.size ());
+  std::vector <bool> seen (images_.size ());
+
+  for (std::uint32_t i = 0; i < sprite_count; i++)
+    {
+      std::uint32_t size, page, x, y, width, height;
+
+      if (!read (size) || size > 4096)
+        return false;
+
+      std::string name (size, '\0');
+
+      if (!in.read (name.data (), size))
+        return false;
+
+      if (!read (page) || !read (x) || !read (y) || !read (width) || !read (height))
+        return false;
+
+      auto iter = names_.find (name);
+
+      if (iter == names_.end () || seen[iter->second] || page >= page_count)
+        return false;
+
+      if (width < 1 || width > std::uint32_t (page_width_) || x > std::uint32_t (page_width_) - width ||
+          height < 1 || height > std::uint32_t (page_height_) || y > std::uint32_t (page_height_) - height)
+        return false;
+
+      seen[iter->second] = true;
+      image& img = placed[iter->second];
+      img.page = page;
+      img.x = int (x);
+      img.y = int (y);
+      img.width = int (width);
+      img.height = int (height);
+    }
+
+  // Pages. They were saved premultiplied, so they must not be premultiplied
+  // again on loading
+  std::vector <bitmap> pages;
+  const int flags = al_get_new_bitmap_flags ();
+  al_set_new_bitmap_flags (flags | ALLEGRO_NO_PREMULTIPLIED_ALPHA);
+
+  for (std::uint32_t i = 0; i < page_count; i++)
+    {
+      bitmap page (get_page_path (path, i));
+
+      if (!page || page.get_width () != page_width_ || page.get_height () != page_height_)
+        break;
+
+      pages.push_back (page);
+    }
+
+  al_set_new_bitmap_flags (flags);
+
+  if (pages.size () != page_count)
+    return false;
+
+  // Commit
+  for (std::size_t i = 0; i < images_.size (); i++)
+    {
+      images_[i].page = placed[i].page;
+      images_[i].x = placed[i].x;
+      images_[i].y = placed[i].y;
+      images_[i].width = placed[i].width;
+      images_[i].height = placed[i].height;
+    }
+
+  pages_ = std::move (pages);
+  make_sprites ();
+
+  return true;
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Save atlas
+//! \param path Manifest path. Pages are saved next to it, as PATH.N.png
+//!
+//! The manifest is written last, so an interrupted save leaves no manifest
+//! and the next load fails, instead of returning a partial atlas.
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+void
+atlas::impl::save (const std::string& path) const
+{
+  if (sprites_.size () != images_.size ())
+    throw std::runtime_error ("atlas is not built");
+
+  std::remove (path.c_str ());
+
+  for (std::size_t i = 0; i < pages_.size (); i++)
+    pages_[i].save (get_page_path (path, i));
+
+  std::ofstream out (path, std::ios::binary);
+
+  if (!out)
+    throw std::runtime_error ("unable to write atlas file: " + path);
+
+  auto write = [&](std::uint32_t value)
+  {
+    out.write (reinterpret_cast <const char *> (&value), 4);
+  };
+
+  const std::uint64_t key = get_key ();
+
+  out.write (MAGIC, sizeof (MAGIC));
+  out.write (reinterpret_cast <const char *> (&key), sizeof (key));
+  write (ORDER_MARK);
+  write (VERSION);
+  write (std::uint32_t (pages_.size ()));
+  write (std::uint32_t (images_.size ()));
+
+  for (const auto& img : images_)
+    {
+      write (std::uint32_t (img.name.size ()));
+      out.write (img.name.data (), std::streamsize (img.name.size ()));
+      write (std::uint32_t (img.page));
+      write (std::uint32_t (img.x));
+      write (std::uint32_t (img.y));
+      write (std::uint32_t (img.width));
+      write (std::uint32_t (img.height));
+    }
+
+  out.close ();
+
+  if (!out)
+    throw std::runtime_error ("unable to write atlas file: " + path);
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Check if atlas has a built sprite
+//! \param name Sprite name
+//! \return true if sprite exists
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+bool
+atlas::impl::has_sprite (const std::string& name) const
+{
+  auto iter = names_.find (name);
+  return iter != names_.end () && iter->second < sprites_.size ();
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Get sprite
+//! \param name Sprite name
+//! \return Sprite
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+sprite
+atlas::impl::get_sprite (const std::string& name) const
+{
+  auto iter = names_.find (name);
+
+  if (iter == names_.end () || iter->second >= sprites_.size ())
+    throw std::invalid_argument ("unknown atlas sprite: " + name);
+
+  return sprites_[iter->second];
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Get number of built sprites
+//! \return Number of sprites
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+std::size_t
+atlas::impl::get_sprite_count () const
+{
+  return sprites_.size ();
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Get number of pages
+//! \return Number of pages
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+std::size_t
+atlas::impl::get_page_count () const
+{
+  return pages_.size ();
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Get page
+//! \param i Page index
+//! \return Page bitmap
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+bitmap
+atlas::impl::get_page (std::size_t i) const
+{
+  if (i >= pages_.size ())
+    throw std::invalid_argument ("invalid atlas page index");
+
+  return pages_[i];
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Constructor
+//! \param page Atlas page
+//! \param x Left column on page
+//! \param y Top row on page
+//! \param width Width in pixels
+//! \param height Height in pixels
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+sprite::sprite (const bitmap& page, int x, int y, int width, int height)
+  : page_ (page),
+    bitmap_ (page.create_sub_bitmap (x, y, width, height)),
+    x_ (x),
+    y_ (y),
+    width_ (width),
+    height_ (height)
+{
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Get left column on page
+//! \return Column
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+int
+sprite::get_x () const noexcept
+{
+  return x_;
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Get top row on page
+//! \return Row
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+int
+sprite::get_y () const noexcept
+{
+  return y_;
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Get width
+//! \return Width in pixels
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+int
+sprite::get_width () const noexcept
+{
+  return width_;
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Get height
+//! \return Height in pixels
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+int
+sprite::get_height () const noexcept
+{
+  return height_;
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Get atlas page
+//! \return Page bitmap
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+const bitmap&
+sprite::get_page () const noexcept
+{
+  return page_;
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Get sprite bitmap
+//! \return Sub-bitmap of the page
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+const bitmap&
+sprite::get_bitmap () const noexcept
+{
+  return bitmap_;
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Draw sprite
+//! \param x X pos
+//! \param y Y pos
+//! \param flags Flags
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+void
+sprite::draw (float x, float y, int flags) const
+{
+  al_draw_bitmap (bitmap_.get_implementation (), x, y, flags);
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Draw scaled sprite
+//! \param x X pos
+//! \param y Y pos
+//! \param width Destination width
+//! \param height Destination height
+//! \param flags Flags
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+void
+sprite::draw_scaled (float x, float y, float width, float height, int flags) const
+{
+  al_draw_scaled_bitmap (bitmap_.get_implementation (), 0, 0, width_, height_, x, y, width, height, flags);
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Constructor
+//! \param page_width Page width in pixels
+//! \param page_height Page height in pixels
+//! \param padding Transparent pixels between images
+//! \param extrude Times edge pixels are repeated around each image
+//! \param threads Worker threads, including the calling one
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+atlas::atlas (int page_width, int page_height, int padding, int extrude, unsigned int threads)
+  : impl_ (std::make_shared <impl> (page_width, page_height, padding, extrude, threads))
+{
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Add image file
+//! \param name Sprite name
+//! \param path Image file path, decoded by build
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+void
+atlas::add (const std::string& name, const std::string& path)
+{
+  impl_->add (name, path);
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Add bitmap
+//! \param name Sprite name
+//! \param b Bitmap, whose pixels are copied
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+void
+atlas::add (const std::string& name, const bitmap& b)
+{
+  impl_->add (name, b);
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Build atlas
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+void
+atlas::build ()
+{
+  impl_->build ();
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Load atlas saved by save
+//! \param path Manifest path
+//! \return true if loaded, false if missing, invalid or out of date
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+bool
+atlas::load (const std::string& path)
+{
+  return impl_->load (path);
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Save atlas
+//! \param path Manifest path. Pages are saved next to it, as PATH.N.png
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+void
+atlas::save (const std::string& path) const
+{
+  impl_->save (path);
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Check if atlas has a built sprite
+//! \param name Sprite name
+//! \return true if sprite exists
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+bool
+atlas::has_sprite (const std::string& name) const
+{
+  return impl_->has_sprite (name);
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Get sprite
+//! \param name Sprite name
+//! \return Sprite
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+sprite
+atlas::get_sprite (const std::string& name) const
+{
+  return impl_->get_sprite (name);
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Get number of built sprites
+//! \return Number of sprites
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+std::size_t
+atlas::get_sprite_count () const
+{
+  return impl_->get_sprite_count ();
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Get number of pages
+//! \return Number of pages
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+std::size_t
+atlas::get_page_count () const
+{
+  return impl_->get_page_count ();
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Get page
+//! \param i Page index
+//! \return Page bitmap
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+bitmap
+atlas::get_page (std::size_t i) const
+{
+  return impl_->get_page (i);
+}
+
+} // namespace allegropp
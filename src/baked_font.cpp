@@ -0,0 +1,350 @@
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @author      Eduardo Aguiar <aguiar@protonmail.ch>
+// @copyright   Copyright (c) 2025 Eduardo Aguiar
+//
+// This file is part of Allegro++.
+// 
+// Allegro++ is free software: you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+// 
+// You should have received a copy of the GNU Lesser General Public License
+// along with Allegro++. If not, see <https://www.gnu.org/licenses/>.
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+#include "baked_font.hpp"
+#include "file_mapping.hpp"
+#include "utf8.hpp"
+#include <allegropp/bitmap.hpp>
+#include <allegropp/font.hpp>
+#include <allegro5/allegro.h>
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <stdexcept>
+#include <vector>
+
+namespace
+{
+//! \brief Sheet image width
+constexpr int SHEET_WIDTH = 1024;
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Allegro state saved for the lifetime of the object (RAII)
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+class state_guard
+{
+public:
+  explicit state_guard (int flags) { al_store_state (&state_, flags); }
+  state_guard (const state_guard&) = delete;
+  ~state_guard () { al_restore_state (&state_); }
+  state_guard& operator= (const state_guard&) = delete;
+
+private:
+  ALLEGRO_STATE state_;
+};
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Find the face closest to a size in a mapped metrics file
+//! \param file Mapped metrics file
+//! \param size Font size. Negative sizes are taken as their absolute value
+//! \param ranges Set to the code point ranges, in the mapping
+//! \param range_count Set to the number of ranges
+//! \return Face, in the mapping
+//! \throws std::runtime_error If the file is not a valid baked font
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+const allegropp::baked_font_face *
+find_face (const allegropp::file_mapping& file, int size, const int *& ranges, int& range_count)
+{
+  const std::runtime_error invalid ("invalid baked font file");
+  allegropp::baked_font_header header;
+
+  if (file.get_size () < sizeof (header))
+    throw invalid;
+
+  std::memcpy (&header, file.get_data (), sizeof (header));
+
+  if (std::memcmp (header.magic, allegropp::baked_font_header::MAGIC, sizeof (header.magic)) != 0 ||
+      header.byte_order != allegropp::baked_font_header::ORDER_MARK ||
+      header.version != allegropp::baked_font_header::VERSION ||
+      header.face_count == 0 || header.face_count > 0xffff ||
+      header.range_count == 0 || header.range_count > 0x110000)
+    throw invalid;
+
+  const std::size_t ranges_offset = sizeof (header) + std::size_t (header.face_count) * sizeof (allegropp::baked_font_face);
+
+  if (file.get_size () < ranges_offset + std::size_t (header.range_count) * 2 * sizeof (std::int32_t))
+    throw invalid;
+
+  // Records are 4-byte aligned in the mapping, so they are used in place
+  const auto *faces = reinterpret_cast <const allegropp::baked_font_face *> (file.get_data () + sizeof (header));
+  ranges = reinterpret_cast <const int *> (file.get_data () + ranges_offset);
+  range_count = int (header.range_count);
+
+  // Sizes come from the file, so distances are taken in 64 bits
+  const std::int64_t target = std::llabs (size);
+  const allegropp::baked_font_face *best = faces;
+
+  for (std::uint32_t i = 1; i < header.face_count; i++)
+    if (std::llabs (faces[i].size - target) < std::llabs (best->size - target))
+      best = faces + i;
+
+  return best;
+}
+
+} // namespace
+
+namespace allegropp
+{
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Allegro font loader for baked fonts
+//! \param filename Metrics file path
+//! \param size Font size. The closest baked size is loaded
+//! \return Allegro font, or nullptr on failure
+//!
+//! The metrics file is mapped, not read, and its ranges are handed to
+//! al_grab_font_from_bitmap in place. The sheet is decoded into a memory
+//! bitmap, so al_grab_font_from_bitmap reads it without a download, and its
+//! clone of the face region, made with the caller's new bitmap flags, is the
+//! only texture created.
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+ALLEGRO_FONT *
+load_baked_font (const char *filename, int size, int)
+{
+  try
+    {
+      file_mapping file (filename);
+      const int *ranges = nullptr;
+      int range_count = 0;
+      const baked_font_face *face = find_face (file, size, ranges, range_count);
+
+      // Decode sheet as is, since it holds premultiplied pixels already
+      bitmap sheet;
+
+      {
+        state_guard guard (ALLEGRO_STATE_NEW_BITMAP_PARAMETERS);
+        al_set_new_bitmap_flags (ALLEGRO_MEMORY_BITMAP | ALLEGRO_NO_PREMULTIPLIED_ALPHA);
+        sheet = bitmap (std::string (filename) + BAKED_FONT_SHEET_SUFFIX);
+      }
+
+      // Compare each value with the sheet size first, so sums cannot overflow
+      if (!sheet ||
+          face->x < 0 || face->y < 0 || face->width < 3 || face->height < 3 ||
+          face->width > sheet.get_width () || face->x > sheet.get_width () - face->width ||
+          face->height > sheet.get_height () || face->y > sheet.get_height () - face->height)
+        return nullptr;
+
+      bitmap region = sheet.create_sub_bitmap (face->x, face->y, face->width, face->height);
+
+      if (!region)
+        return nullptr;
+
+      return al_grab_font_from_bitmap (region.get_implementation (), range_count, ranges);
+    }
+  catch (const std::exception&)
+    {
+      // Allegro font loaders report failure with nullptr
+      return nullptr;
+    }
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Get the metrics of the face a baked font loads for a size
+//! \param path Metrics file path
+//! \param size Font size
+//! \param face Set to the face metrics
+//! \return true if path is a valid baked font file
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+bool
+get_baked_font_face (const std::string& path, int size, baked_font_face& face)
+{
+  try
+    {
+      file_mapping file (path);
+      const int *ranges = nullptr;
+      int range_count = 0;
+      face = *find_face (file, size, ranges, range_count);
+      return true;
+    }
+  catch (const std::exception&)
+    {
+      return false;
+    }
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Bake a font into a sheet image and a metrics file
+//! \param path Font path
+//! \param sizes Font sizes to bake
+//! \param charset UTF-8 characters to bake. Empty for printable ASCII
+//! \param output Metrics file path, ending with ".alppfont". The sheet is
+//!        saved next to it, with ".png" appended
+//! \param flags Font loading flags (ALLEGRO_TTF_NO_KERNING, etc)
+//! \throws std::invalid_argument If sizes is empty or holds a size < 1, or
+//!         output does not end with ".alppfont"
+//! \throws std::runtime_error If the font cannot be loaded or the files
+//!         cannot be written
+//!
+//! Each glyph is rendered once, clipped to a cell one advance wide and one
+//! line high, so baked fonts draw with no rasterization at run time. They
+//! are drawn without kerning, and glyph parts outside their cell are cut.
+//! Load them with font (output, size); sizes not baked get the closest one.
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+void
+bake_font (const std::string& path, const std::vector <std::size_t>& sizes, std::string_view charset, const std::string& output, int flags)
+{
+  if (sizes.empty ())
+    throw std::invalid_argument ("no font sizes to bake");
+
+  // Font loaders are picked by extension, so other names would not load
+  const std::string_view extension = BAKED_FONT_EXTENSION;
+
+  if (output.size () < extension.size () ||
+      output.compare (output.size () - extension.size (), extension.size (), extension) != 0)
+    throw std::invalid_argument ("baked font path must end with " + std::string (extension) + ": " + output);
+
+  // Decode character set into sorted code point ranges
+  std::vector <std::int32_t> cps;
+
+  if (charset.empty ())
+    for (std::int32_t cp = ' '; cp <= '~'; cp++)
+      cps.push_back (cp);
+
+  else
+    for (std::size_t pos = 0; pos < charset.size ();)
+      cps.push_back (decode_utf8 (charset, pos));
+
+  std::sort (cps.begin (), cps.end ());
+  cps.erase (std::unique (cps.begin (), cps.end ()), cps.end ());
+
+  std::vector <std::int32_t> ranges;
+
+  for (std::int32_t cp : cps)
+    {
+      if (ranges.empty () || cp != ranges.back () + 1)
+        ranges.insert (ranges.end (), {cp, cp});
+
+      else
+        ranges.back () = cp;
+    }
+
+  // Load fonts with memory glyph caches, as they are drawn to a memory sheet
+  state_guard guard (ALLEGRO_STATE_NEW_BITMAP_PARAMETERS | ALLEGRO_STATE_TARGET_BITMAP | ALLEGRO_STATE_BLENDER);
+  al_set_new_bitmap_flags (ALLEGRO_MEMORY_BITMAP);
+
+  // Lay out cells, face regions stacked top to bottom
+  struct cell
+  {
+    int x = 0;
+    int y = 0;
+    int width = 0;
+  };
+
+  std::vector <font> fonts;
+  std::vector <baked_font_face> faces;
+  std::vector <std::vector <cell>> cells;
+  int sheet_height = 0;
+
+  for (std::size_t size : sizes)
+    {
+      if (size < 1)
+        throw std::invalid_argument ("invalid font size");
+
+      font f (path, size, flags);
+
+      if (!f)
+        throw std::runtime_error ("cannot load font: " + path);
+
+      ALLEGRO_FONT *obj = f.get_implementation ();
+
+      baked_font_face face;
+      face.size = std::int32_t (size);
+      face.line_height = al_get_font_line_height (obj);
+      face.ascent = al_get_font_ascent (obj);
+      face.descent = al_get_font_descent (obj);
+      face.x = 0;
+      face.y = sheet_height;
+      face.width = SHEET_WIDTH;
+
+      const int height = std::max (face.line_height, 1);
+      std::vector <cell> face_cells;
+      int x = 1;
+      int y = 1;
+
+      for (std::int32_t cp : cps)
+        {
+          const int width = std::max (al_get_glyph_advance (obj, cp, ALLEGRO_NO_KERNING), 1);
+
+          if (width > SHEET_WIDTH - 2)
+            throw std::invalid_argument ("glyph too wide to bake");
+
+          if (x + width >= SHEET_WIDTH)
+            {
+              x = 1;
+              y += height + 1;
+            }
+
+          face_cells.push_back ({x, face.y + y, width});
+          x += width + 1;
+        }
+
+      face.height = y + height + 1;
+      sheet_height += face.height;
+
+      fonts.push_back (std::move (f));
+      faces.push_back (face);
+      cells.push_back (std::move (face_cells));
+    }
+
+  // Render glyphs in white, on transparent cells framed by the background
+  bitmap sheet (SHEET_WIDTH, std::size_t (sheet_height));
+
+  if (!sheet)
+    throw std::runtime_error ("cannot create baked font sheet");
+
+  al_set_target_bitmap (sheet.get_implementation ());
+  al_set_blender (ALLEGRO_ADD, ALLEGRO_ONE, ALLEGRO_INVERSE_ALPHA);
+  al_clear_to_color (al_map_rgb (255, 0, 255));
+
+  for (std::size_t i = 0; i < faces.size (); i++)
+    {
+      ALLEGRO_FONT *obj = fonts[i].get_implementation ();
+      const int height = std::max (faces[i].line_height, 1);
+
+      for (std::size_t j = 0; j < cps.size (); j++)
+        {
+          const cell& c = cells[i][j];
+
+          al_set_clipping_rectangle (c.x, c.y, c.width, height);
+          al_clear_to_color (al_map_rgba (0, 0, 0, 0));
+          al_draw_glyph (obj, al_map_rgb (255, 255, 255), float (c.x), float (c.y), cps[j]);
+        }
+    }
+
+  al_reset_clipping_rectangle ();
+  sheet.save (output + BAKED_FONT_SHEET_SUFFIX);
+
+  // Write metrics
+  baked_font_header header = {};
+  std::memcpy (header.magic, baked_font_header::MAGIC, sizeof (header.magic));
+  header.byte_order = baked_font_header::ORDER_MARK;
+  header.version = baked_font_header::VERSION;
+  header.face_count = std::uint32_t (faces.size ());
+  header.range_count = std::uint32_t (ranges.size () / 2);
+
+  std::ofstream out (output, std::ios::binary);
+  out.write (reinterpret_cast <const char *> (&header), sizeof (header));
+  out.write (reinterpret_cast <const char *> (faces.data ()), std::streamsize (faces.size () * sizeof (baked_font_face)));
+  out.write (reinterpret_cast <const char *> (ranges.data ()), std::streamsize (ranges.size () * sizeof (std::int32_t)));
+
+  if (!out)
+    throw std::runtime_error ("cannot write baked font: " + output);
+}
+
+} // namespace allegropp
@@ -0,0 +1,89 @@
+#ifndef ALLEGROPP_BAKED_FONT
+#define ALLEGROPP_BAKED_FONT
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @author      Eduardo Aguiar <aguiar@protonmail.ch>
+// @copyright   Copyright (c) 2025 Eduardo Aguiar
+//
+// This file is part of Allegro++.
+// 
+// Allegro++ is free software: you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+// 
+// You should have received a copy of the GNU Lesser General Public License
+// along with Allegro++. If not, see <https://www.gnu.org/licenses/>.
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+#include <allegro5/allegro_font.h>
+#include <cstdint>
+#include <string>
+
+namespace allegropp
+{
+//! \brief Baked font metrics file extension, registered as an Allegro font loader
+constexpr char BAKED_FONT_EXTENSION[] = ".alppfont";
+
+//! \brief Baked font sheet image suffix, appended to the metrics file path
+constexpr char BAKED_FONT_SHEET_SUFFIX[] = ".png";
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Header of a baked font metrics file
+//!
+//! The header is followed by face_count baked_font_face records and by
+//! range_count pairs of 32-bit first and last code points. Numbers are in
+//! host byte order, checked through ORDER_MARK, so the ranges are passed
+//! to al_grab_font_from_bitmap straight from the mapped file.
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+struct baked_font_header
+{
+  static constexpr char MAGIC[8] = {'A', 'L', 'P', 'P', 'F', 'O', 'N', 'T'};
+  static constexpr std::uint32_t ORDER_MARK = 0x01020304;
+  static constexpr std::uint16_t VERSION = 1;
+
+  char magic[8];                //!< MAGIC
+  std::uint32_t byte_order;     //!< ORDER_MARK, as written by the host
+  std::uint16_t version;        //!< File format version
+  std::uint16_t reserved;       //!< Zero
+  std::uint32_t face_count;     //!< Number of baked sizes
+  std::uint32_t range_count;    //!< Number of code point ranges
+  std::uint32_t unused[2];      //!< Zero
+};
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief One baked size: font metrics and its region of the sheet image
+//!
+//! The region is laid out for al_grab_font_from_bitmap: one cell per code
+//! point, in range order, each cell one advance wide and one line high,
+//! surrounded by a 1 pixel border of the sheet background color.
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+struct baked_font_face
+{
+  std::int32_t size;            //!< Font size the face was baked at
+  std::int32_t line_height;     //!< Line height
+  std::int32_t ascent;          //!< Ascent
+  std::int32_t descent;         //!< Descent
+  std::int32_t x;               //!< Region left
+  std::int32_t y;               //!< Region top
+  std::int32_t width;           //!< Region width
+  std::int32_t height;          //!< Region height
+};
+
+static_assert (sizeof (baked_font_header) == 32, "baked_font_header must be 32 bytes");
+static_assert (sizeof (baked_font_face) == 32, "baked_font_face must be 32 bytes");
+static_assert (sizeof (int) == sizeof (std::int32_t), "code point ranges are mapped as int");
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// Function prototypes
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+ALLEGRO_FONT *load_baked_font (const char *, int, int);
+bool get_baked_font_face (const std::string&, int, baked_font_face&);
+
+} // namespace allegropp
+
+#endif
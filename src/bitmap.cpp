@@ -18,33 +18,17 @@
 // along with Allegro++. If not, see <https://www.gnu.org/licenses/>.
 // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
 #include <allegropp/bitmap.hpp>
+#include <allegropp/bitmap_lock.hpp>
 #include <allegropp/allegropp.hpp>
 #include <allegro5/allegro.h>
-#include <allegro5/allegro_image.h>
-#include <mutex>
-
-namespace
-{
-std::once_flag is_initialized_;
-
-// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
-//! \brief Initialize Allegro image subsystem
-// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
-static void
-_init ()
-{
-  allegropp::init ();       // Initialize Allegro main system
-  al_init_image_addon ();   // Initialize image subsystem
-}
-
-} // namespace
+#include <stdexcept>
 
 namespace allegropp
 {
 // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
 //! \brief <i>bitmap</i> implementation class
 // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
-class bitmap::impl
+class bitmap::impl : public std::enable_shared_from_this <bitmap::impl>
 {
 public:
 
@@ -80,10 +64,24 @@ public:
   void draw (int, int, int);
   void draw_scaled (int, int, int, int, int, int, int, int, int);
   bitmap clone () const;
+  bitmap create_sub_bitmap (int, int, int, int) const;
+
+  // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+  //! \brief Get implementation object
+  //! \return Allegro bitmap
+  // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+  ALLEGRO_BITMAP *
+  get_implementation () const
+  {
+      return obj_;
+  }
 
 private:
   //! \brief Allegro bitmap object
   ALLEGRO_BITMAP *obj_ = nullptr;
+
+  //! \brief Parent bitmap, kept alive while this sub-bitmap exists
+  std::shared_ptr <const impl> parent_;
 };
 
 // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
@@ -92,7 +90,7 @@ private:
 // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
 bitmap::impl::impl (const std::string& path)
 {
-    std::call_once (is_initialized_, _init);
+    init_image ();
     obj_ = al_load_bitmap (path.c_str ());
 }
 
@@ -103,7 +101,7 @@ bitmap::impl::impl (const std::string& path)
 // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
 bitmap::impl::impl (std::size_t width, std::size_t height)
 {
-    std::call_once (is_initialized_, _init);
+    init_image ();
     obj_ = al_create_bitmap (width, height);
 }
 
@@ -184,6 +182,27 @@ bitmap::impl::clone () const
   return bitmap (p);
 }
 
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Create sub-bitmap
+//! \param x Left column
+//! \param y Top row
+//! \param width Width in pixels
+//! \param height Height in pixels
+//! \return Bitmap sharing this bitmap's pixels
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+bitmap
+bitmap::impl::create_sub_bitmap (int x, int y, int width, int height) const
+{
+  if (!obj_)
+    throw std::invalid_argument ("null bitmap object");
+
+  auto p = std::make_shared <impl> ();
+  p->obj_ = al_create_sub_bitmap (obj_, x, y, width, height);
+  p->parent_ = shared_from_this ();
+
+  return bitmap (p);
+}
+
 // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
 //! \brief Constructor
 // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
@@ -288,4 +307,72 @@ bitmap::clone () const
   return impl_->clone ();
 }
 
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Create sub-bitmap
+//! \param x Left column
+//! \param y Top row
+//! \param width Width in pixels
+//! \param height Height in pixels
+//! \return Bitmap sharing this bitmap's pixels (and texture)
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+bitmap
+bitmap::create_sub_bitmap (int x, int y, int width, int height) const
+{
+  return impl_->create_sub_bitmap (x, y, width, height);
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Save bitmap to file
+//! \param path File path. The extension selects the image format
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+void
+bitmap::save (const std::string& path) const
+{
+  ALLEGRO_BITMAP *obj = get_implementation ();
+
+  if (!obj)
+    throw std::invalid_argument ("null bitmap object");
+
+  if (!al_save_bitmap (path.c_str (), obj))
+    throw std::runtime_error ("cannot save bitmap: " + path);
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Get implementation object
+//! \return Allegro bitmap
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+ALLEGRO_BITMAP *
+bitmap::get_implementation () const
+{
+  return impl_->get_implementation ();
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Lock whole bitmap for direct pixel access
+//! \param format Allegro pixel format (ALLEGRO_PIXEL_FORMAT_ANY for the bitmap's own)
+//! \param mode Lock mode
+//! \return Lock, unlocking the bitmap when destroyed
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+bitmap_lock
+bitmap::lock (int format, lock_mode mode) const
+{
+  return bitmap_lock (*this, 0, 0, get_width (), get_height (), format, mode);
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Lock bitmap region for direct pixel access
+//! \param x Region left column
+//! \param y Region top row
+//! \param width Region width
+//! \param height Region height
+//! \param format Allegro pixel format (ALLEGRO_PIXEL_FORMAT_ANY for the bitmap's own)
+//! \param mode Lock mode
+//! \return Lock, unlocking the bitmap when destroyed
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+bitmap_lock
+bitmap::lock (int x, int y, int width, int height, int format, lock_mode mode) const
+{
+  return bitmap_lock (*this, x, y, width, height, format, mode);
+}
+
 } // namespace allegropp
@@ -0,0 +1,312 @@
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @author      Eduardo Aguiar <aguiar@protonmail.ch>
+// @copyright   Copyright (c) 2025 Eduardo Aguiar
+//
+// This file is part of Allegro++.
+// 
+// Allegro++ is free software: you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+// 
+// You should have received a copy of the GNU Lesser General Public License
+// along with Allegro++. If not, see <https://www.gnu.org/licenses/>.
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+#include <allegropp/bitmap_lock.hpp>
+#include <stdexcept>
+#include <utility>
+
+namespace
+{
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Channel order of a 32-bit pixel, as a native-endian word
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+enum channel_order : int
+{
+  ORDER_ARGB = 0,   //!< A << 24 | R << 16 | G << 8 | B
+  ORDER_RGBA,       //!< R << 24 | G << 16 | B << 8 | A
+  ORDER_ABGR        //!< A << 24 | B << 16 | G << 8 | R
+};
+
+//! \brief Channel shifts (R, G, B, A) of each channel order
+constexpr int SHIFTS[3][4] =
+{
+  {16, 8, 0, 24},
+  {24, 16, 8, 0},
+  {0, 8, 16, 24}
+};
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Layout of a 32-bit pixel format
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+struct pixel_layout
+{
+  channel_order order;  //!< Channel order
+  bool has_alpha;       //!< false for X formats (alpha reads as 255)
+};
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Get layout of a 32-bit pixel format
+//! \param format Allegro pixel format
+//! \return Layout
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+pixel_layout
+get_layout (int format)
+{
+  switch (format)
+    {
+      case ALLEGRO_PIXEL_FORMAT_ARGB_8888: return {ORDER_ARGB, true};
+      case ALLEGRO_PIXEL_FORMAT_RGBA_8888: return {ORDER_RGBA, true};
+      case ALLEGRO_PIXEL_FORMAT_ABGR_8888: return {ORDER_ABGR, true};
+      case ALLEGRO_PIXEL_FORMAT_XRGB_8888: return {ORDER_ARGB, false};
+      case ALLEGRO_PIXEL_FORMAT_RGBX_8888: return {ORDER_RGBA, false};
+      case ALLEGRO_PIXEL_FORMAT_XBGR_8888: return {ORDER_ABGR, false};
+
+      case ALLEGRO_PIXEL_FORMAT_ABGR_8888_LE:
+        {
+          // Bytes R, G, B, A in memory, whatever the CPU byte order
+          const std::uint32_t probe = 1;
+          const bool little_endian = *reinterpret_cast <const std::uint8_t *> (&probe) == 1;
+
+          return {little_endian ? ORDER_ABGR : ORDER_RGBA, true};
+        }
+
+      default:
+        throw std::invalid_argument ("convert only supports 32-bit RGB pixel formats");
+    }
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Convert a row of pixels between channel orders
+//! \param src Source row
+//! \param dst Destination row
+//! \param width Number of pixels
+//! \param alpha Bits ORed into every pixel (opaque alpha, for X sources)
+//!
+//! Shifts are compile-time constants and rows do not overlap, so compilers
+//! turn the loop into vector code running close to memcpy speed.
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+template <int FROM, int TO>
+void
+convert_row (const std::uint32_t *__restrict src, std::uint32_t *__restrict dst, int width, std::uint32_t alpha)
+{
+  constexpr const int *from = SHIFTS[FROM];
+  constexpr const int *to = SHIFTS[TO];
+
+  for (int x = 0; x < width; x++)
+    {
+      const std::uint32_t p = src[x];
+
+      dst[x] = (((p >> from[0]) & 0xff) << to[0]) |
+               (((p >> from[1]) & 0xff) << to[1]) |
+               (((p >> from[2]) & 0xff) << to[2]) |
+               (((p >> from[3]) & 0xff) << to[3]) |
+               alpha;
+    }
+}
+
+//! \brief Row converters, by source and destination channel order
+using convert_row_fn = void (*) (const std::uint32_t *, std::uint32_t *, int, std::uint32_t);
+
+constexpr convert_row_fn CONVERT_ROW[3][3] =
+{
+  {convert_row <0, 0>, convert_row <0, 1>, convert_row <0, 2>},
+  {convert_row <1, 0>, convert_row <1, 1>, convert_row <1, 2>},
+  {convert_row <2, 0>, convert_row <2, 1>, convert_row <2, 2>}
+};
+
+} // namespace
+
+namespace allegropp
+{
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Constructor
+//! \param b Bitmap
+//! \param x Region left column
+//! \param y Region top row
+//! \param width Region width
+//! \param height Region height
+//! \param format Allegro pixel format (ALLEGRO_PIXEL_FORMAT_ANY for the bitmap's own)
+//! \param mode Lock mode
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+bitmap_lock::bitmap_lock (const bitmap& b, int x, int y, int width, int height, int format, bitmap::lock_mode mode)
+  : bitmap_ (b),
+    width_ (width),
+    height_ (height),
+    mode_ (mode)
+{
+  ALLEGRO_BITMAP *obj = bitmap_.get_implementation ();
+
+  if (!obj)
+    throw std::invalid_argument ("null bitmap object");
+
+  if (x < 0 || y < 0 || width <= 0 || height <= 0 ||
+      x + width > al_get_bitmap_width (obj) || y + height > al_get_bitmap_height (obj))
+    throw std::invalid_argument ("lock region out of bitmap bounds");
+
+  region_ = al_lock_bitmap_region (obj, x, y, width, height, format, mode);
+
+  if (!region_)
+    throw std::runtime_error ("cannot lock bitmap");
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Move constructor
+//! \param other Lock being moved from, left unlocked
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+bitmap_lock::bitmap_lock (bitmap_lock&& other) noexcept
+  : bitmap_ (other.bitmap_),
+    region_ (std::exchange (other.region_, nullptr)),
+    width_ (other.width_),
+    height_ (other.height_),
+    mode_ (other.mode_)
+{
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Destructor
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+bitmap_lock::~bitmap_lock ()
+{
+  unlock ();
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Move assignment
+//! \param other Lock being moved from, left unlocked
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+bitmap_lock&
+bitmap_lock::operator= (bitmap_lock&& other) noexcept
+{
+  if (this != &other)
+    {
+      unlock ();
+      bitmap_ = other.bitmap_;
+      region_ = std::exchange (other.region_, nullptr);
+      width_ = other.width_;
+      height_ = other.height_;
+      mode_ = other.mode_;
+    }
+
+  return *this;
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Unlock bitmap. Spans obtained from this lock become invalid
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+void
+bitmap_lock::unlock ()
+{
+  if (region_)
+    {
+      al_unlock_bitmap (bitmap_.get_implementation ());
+      region_ = nullptr;
+    }
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Get region width
+//! \return Width in pixels
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+int
+bitmap_lock::get_width () const noexcept
+{
+  return width_;
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Get region height
+//! \return Height in pixels
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+int
+bitmap_lock::get_height () const noexcept
+{
+  return height_;
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Get pixel format of the locked memory
+//! \return Allegro pixel format, or ALLEGRO_PIXEL_FORMAT_ANY if unlocked
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+int
+bitmap_lock::get_format () const noexcept
+{
+  return region_ ? region_->format : ALLEGRO_PIXEL_FORMAT_ANY;
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Get pixel size of the locked memory
+//! \return Bytes per pixel, or 0 if unlocked
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+int
+bitmap_lock::get_pixel_size () const noexcept
+{
+  return region_ ? region_->pixel_size : 0;
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Get lock mode
+//! \return Lock mode
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+bitmap::lock_mode
+bitmap_lock::get_mode () const noexcept
+{
+  return mode_;
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Check whether a span type can view the locked memory
+//! \param size Size of the pixel type
+//! \param is_const Whether the pixel type is const
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+void
+bitmap_lock::check_span (std::size_t size, bool is_const) const
+{
+  if (!region_)
+    throw std::logic_error ("bitmap is not locked");
+
+  if (size != std::size_t (region_->pixel_size))
+    throw std::invalid_argument ("span pixel type does not match locked pixel size");
+
+  if (mode_ == bitmap::READ_ONLY && !is_const)
+    throw std::invalid_argument ("read-only lock needs a const pixel type");
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Convert pixels between 32-bit pixel formats
+//! \param src Source span
+//! \param src_format Source Allegro pixel format
+//! \param dst Destination span
+//! \param dst_format Destination Allegro pixel format
+//!
+//! Supports the ARGB, RGBA, ABGR, XRGB, RGBX, XBGR 8888 and ABGR 8888 LE
+//! formats. The top-left rectangle common to both spans is converted. Equal
+//! layouts are copied with memcpy. Spans must not overlap.
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+void
+convert (const pixel_span <const std::uint32_t>& src, int src_format, const pixel_span <std::uint32_t>& dst, int dst_format)
+{
+  const pixel_layout from = get_layout (src_format);
+  const pixel_layout to = get_layout (dst_format);
+
+  if (from.order == to.order && (from.has_alpha || !to.has_alpha))
+    {
+      copy (src, dst);
+      return;
+    }
+
+  const convert_row_fn convert_row = CONVERT_ROW[from.order][to.order];
+  const std::uint32_t alpha = from.has_alpha ? 0 : (0xffu << SHIFTS[to.order][3]);
+  const int width = std::min (src.get_width (), dst.get_width ());
+  const int height = std::min (src.get_height (), dst.get_height ());
+
+  for (int y = 0; y < height; y++)
+    convert_row (src[y], dst[y], width, alpha);
+}
+
+} // namespace allegropp
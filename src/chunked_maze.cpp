@@ -0,0 +1,375 @@
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @author      Eduardo Aguiar <aguiar@protonmail.ch>
+// @copyright   Copyright (c) 2025 Eduardo Aguiar
+//
+// This file is part of Allegro++.
+// 
+// Allegro++ is free software: you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+// 
+// You should have received a copy of the GNU Lesser General Public License
+// along with Allegro++. If not, see <https://www.gnu.org/licenses/>.
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+#include <allegropp/chunked_maze.hpp>
+#include "maze_generator.hpp"
+#include "maze_grid.hpp"
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <cstdio>
+#include <fstream>
+#include <list>
+#include <random>
+#include <stdexcept>
+#include <unordered_map>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
+namespace allegropp
+{
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @struct chunked_maze::impl
+// @brief Private implementation details of the chunked_maze class (PIMPL).
+//
+// Chunk (cx, cy) covers cells [cx * size, (cx + 1) * size) on both axes, and
+// owns the wall lines on its west and north borders. The most recently used
+// chunk is cached, so scans within a chunk skip the hash lookup.
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+struct chunked_maze::impl
+{
+    // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+    // @brief Chunk data
+    // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+    struct chunk
+    {
+        std::vector <maze::wall_type> cells;    ///< size * size cells
+        bool modified = false;          ///< Differs from the generated chunk
+        bool dirty = false;             ///< Differs from its spill file
+    };
+
+    using key_type = std::uint64_t;
+    using lru_type = std::list <std::pair <key_type, chunk>>;
+
+    int size;                                           ///< Chunk side in cells
+    unsigned int seed;                                  ///< Seed value for reproducible generation
+    maze::generator_type generator;                     ///< Generation algorithm
+    std::size_t max_chunks;                             ///< Chunks kept in the LRU cache
+    std::string spill_dir;                              ///< Spill directory, empty if none
+    std::uint64_t instance;                             ///< Instance number, naming spill files
+    lru_type lru;                                       ///< Loaded chunks, most recent first
+    std::unordered_map <key_type, lru_type::iterator> loaded;   ///< Loaded chunks by key
+    std::unordered_map <key_type, chunk> kept;          ///< Evicted modified chunks (no spill)
+    std::unordered_set <key_type> spilled;              ///< Chunks with a spill file
+    key_type last_key = 0;                              ///< Key of last used chunk
+    chunk *last = nullptr;                              ///< Last used chunk
+
+    static inline std::atomic <std::uint64_t> instances {0};    ///< Instances created
+
+    impl (unsigned int s, int cs, std::size_t budget, const std::string& dir, maze::generator_type g)
+      : size (cs + (cs % 2)),           // Chunks hold whole cell/wall pairs
+        generator (g),
+        spill_dir (dir),
+        instance (instances++)
+    {
+        if (cs < 2)
+          throw std::invalid_argument ("invalid maze chunk size");
+
+        if (g > maze::SIDEWINDER)
+          throw std::invalid_argument ("invalid maze generator type");
+
+        if (s)
+          seed = s;
+
+        else
+          {
+            std::random_device rd;
+            seed = rd();
+          }
+
+        max_chunks = std::max <std::size_t> (1, budget / (std::size_t (size) * size));
+    }
+
+    ~impl ()
+    {
+        for (key_type key : spilled)
+          std::remove (get_path (key).c_str ());
+    }
+
+    static int
+    floor_div (int a, int b)
+    {
+        return a / b - (a % b < 0);
+    }
+
+    static key_type
+    make_key (int cx, int cy)
+    {
+        return (key_type (std::uint32_t (cx)) << 32) | std::uint32_t (cy);
+    }
+
+    // Spill files of live instances never collide, whatever their parameters
+    std::string
+    get_path (key_type key) const
+    {
+        return spill_dir + "/maze_" + std::to_string (instance) + "_" +
+               std::to_string (seed) + "_" + std::to_string (size) + "_" +
+               std::to_string (int (generator)) + "_" +
+               std::to_string (int (std::uint32_t (key >> 32))) + "_" +
+               std::to_string (int (std::uint32_t (key))) + ".chunk";
+    }
+
+    // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+    // @brief Gets the cell at a given position, loading its chunk if needed.
+    // @param x X-coordinate.
+    // @param y Y-coordinate.
+    // @param modify True if the cell is about to be changed.
+    // @return Reference to the cell.
+    // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+    maze::wall_type&
+    cell (int x, int y, bool modify)
+    {
+        const int cx = floor_div (x, size);
+        const int cy = floor_div (y, size);
+        chunk& c = get_chunk (cx, cy);
+
+        if (modify)
+          c.modified = c.dirty = true;
+
+        return c.cells[std::size_t (y - cy * size) * size + (x - cx * size)];
+    }
+
+    // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+    // @brief Gets a chunk, making it the most recently used one.
+    // @param cx Chunk X-coordinate.
+    // @param cy Chunk Y-coordinate.
+    // @return Reference to the chunk.
+    // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+    chunk&
+    get_chunk (int cx, int cy)
+    {
+        const key_type key = make_key (cx, cy);
+
+        if (last && key == last_key)
+          return *last;
+
+        auto it = loaded.find (key);
+
+        if (it != loaded.end ())
+          lru.splice (lru.begin (), lru, it->second);
+
+        else
+          {
+            lru.emplace_front (key, load (cx, cy));
+            loaded.emplace (key, lru.begin ());
+            evict ();
+          }
+
+        last_key = key;
+        last = &lru.front ().second;
+        return *last;
+    }
+
+    // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+    // @brief Evicts least recently used chunks beyond max_chunks.
+    // @throws std::runtime_error If a chunk cannot be spilled.
+    // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+    void
+    evict ()
+    {
+        while (lru.size () > max_chunks)
+          {
+            auto& [key, c] = lru.back ();
+
+            if (c.modified)
+              {
+                if (spill_dir.empty ())
+                  kept.emplace (key, std::move (c));
+
+                else if (c.dirty)
+                  {
+                    const std::string path = get_path (key);
+                    std::ofstream out (path, std::ios::binary);
+                    out.write (reinterpret_cast <const char *> (c.cells.data ()), c.cells.size ());
+
+                    if (!out)
+                      throw std::runtime_error ("unable to write maze chunk: " + path);
+
+                    spilled.insert (key);
+                  }
+              }
+
+            loaded.erase (key);
+            lru.pop_back ();
+          }
+    }
+
+    // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+    // @brief Loads a chunk that is not in the LRU cache.
+    // @param cx Chunk X-coordinate.
+    // @param cy Chunk Y-coordinate.
+    // @return Chunk, either kept, read from its spill file or generated.
+    // @throws std::runtime_error If a spill file cannot be read.
+    // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+    chunk
+    load (int cx, int cy)
+    {
+        const key_type key = make_key (cx, cy);
+        chunk c;
+
+        auto it = kept.find (key);
+
+        if (it != kept.end ())
+          {
+            c = std::move (it->second);
+            kept.erase (it);
+          }
+
+        else if (spilled.count (key))
+          {
+            const std::string path = get_path (key);
+            std::ifstream in (path, std::ios::binary);
+            c.cells.resize (std::size_t (size) * size);
+            in.read (reinterpret_cast <char *> (c.cells.data ()), c.cells.size ());
+
+            if (!in)
+              throw std::runtime_error ("unable to read maze chunk: " + path);
+
+            c.modified = true;
+          }
+
+        else
+          c.cells = generate (cx, cy);
+
+        return c;
+    }
+
+    // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+    // @brief Generates a chunk from the seed and its coordinates.
+    // @param cx Chunk X-coordinate.
+    // @param cy Chunk Y-coordinate.
+    // @return Chunk cells.
+    //
+    // The chunk is carved as a (size + 1) x (size + 1) maze, whose east and
+    // south borders belong to the neighbouring chunks and are dropped. One
+    // random cell then opens through the west or north border, as in the
+    // binary tree algorithm at chunk scale.
+    // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+    std::vector <maze::wall_type>
+    generate (int cx, int cy)
+    {
+        std::seed_seq seq {seed, unsigned (cx), unsigned (cy)};
+        std::mt19937 rng (seq);
+
+        maze_byte_grid grid (size + 1, size + 1);
+        maze_generator <maze_byte_grid> (grid, size + 1, size + 1, rng).run (generator);
+
+        std::uniform_int_distribution<int> coin (0, 1);
+        std::uniform_int_distribution<int> dist (0, size / 2 - 1);
+        const int k = 2 * dist (rng) + 1;
+
+        if (coin (rng))
+          grid.set (0, k, maze::PASSAGE);
+        else
+          grid.set (k, 0, maze::PASSAGE);
+
+        std::vector <maze::wall_type> cells (std::size_t (size) * size);
+
+        for (int y = 0; y < size; y++)
+          for (int x = 0; x < size; x++)
+            cells[std::size_t (y) * size + x] = grid.get (x, y);
+
+        return cells;
+    }
+};
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @brief Constructs an unbounded maze.
+// @param seed Random seed for generation; if 0, a random seed is generated.
+// @param chunk_size Chunk side in cells (adjusted to even if odd).
+// @param memory_budget Bytes of chunk data kept loaded (at least one chunk).
+// @param spill_dir Directory for modified chunks evicted from memory; if
+//        empty, they stay in memory. Spill files are removed on destruction.
+// @param generator Generation algorithm for each chunk.
+// @throws std::invalid_argument If chunk_size is less than 2 or generator
+//         is invalid.
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+chunked_maze::chunked_maze (unsigned int seed, int chunk_size, std::size_t memory_budget, const std::string& spill_dir, maze::generator_type generator)
+    : impl_ (std::make_shared<impl> (seed, chunk_size, memory_budget, spill_dir, generator))
+{
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @brief Gets the obstacle type at a given position.
+// @param x X-coordinate (column) of the position, any value.
+// @param y Y-coordinate (row) of the position, any value.
+// @return The type of obstacle (e.g., PASSAGE, WALL) at (x, y).
+// @throws std::runtime_error If a chunk cannot be spilled or read back.
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+maze::wall_type
+chunked_maze::get (int x, int y) const
+{
+    return impl_->cell (x, y, false);
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @brief Sets the obstacle type at a given position.
+// @param x X-coordinate (column) of the position, any value.
+// @param y Y-coordinate (row) of the position, any value.
+// @param type The type to set (e.g., PASSAGE, IRON_WALL).
+// @throws std::runtime_error If a chunk cannot be spilled or read back.
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+void
+chunked_maze::set (int x, int y, maze::wall_type type)
+{
+    impl_->cell (x, y, true) = type;
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @brief Gets the chunk side.
+// @return The number of cells per chunk row and column.
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+int
+chunked_maze::get_chunk_size () const
+{
+    return impl_->size;
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @brief Gets the seed used for maze generation.
+// @return The seed value (user-provided or randomly generated).
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+unsigned int
+chunked_maze::get_seed () const
+{
+    return impl_->seed;
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @brief Gets the algorithm used for chunk generation.
+// @return The generator type selected at construction.
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+maze::generator_type
+chunked_maze::get_generator () const
+{
+    return impl_->generator;
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @brief Gets the number of chunks currently loaded.
+// @return Chunks in the LRU cache, at most the memory budget allows.
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+std::size_t
+chunked_maze::get_loaded_chunks () const
+{
+    return impl_->lru.size ();
+}
+
+} // namespace allegropp
@@ -18,85 +18,20 @@
 // along with Allegro++. If not, see <https://www.gnu.org/licenses/>.
 // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
 #include <allegropp/color.hpp>
+#include "color_names.hpp"
 
 namespace allegropp
 {
-// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
-//! \brief <i>color</i> implementation class
-// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
-class color::impl
-{
-public:
-  // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
-  // Constructors and destructor
-  // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
-  impl () = default;
-  impl (component_type, component_type, component_type);
-  impl (component_type, component_type, component_type, component_type);
-  impl (const impl&) = delete;
-  impl (impl&&) = delete;
-
-  // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
-  // Operators
-  // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
-  impl& operator= (const impl&) = delete;
-  impl& operator= (impl&&) = delete;
-
-  // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
-  //! \brief Get implementation pointer
-  // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
-  ALLEGRO_COLOR
-  get_implementation () const
-  {
-      return obj_;
-  }
-
-  // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
-  // Prototypes
-  // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
-  std::tuple <component_type, component_type, component_type> get_rgb () const;
-  std::tuple <component_type, component_type, component_type, component_type> get_rgba () const;
-  std::string get_name () const;
-  std::string get_html () const;
-
-private:
-  //! \brief Allegro color object
-  ALLEGRO_COLOR obj_;
-};
-
-// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
-//! \brief Constructor
-//! \param r Red component
-//! \param g Green component
-//! \param b Blue component
-// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
-color::impl::impl (component_type r, component_type g, component_type b)
-{
-    obj_ = al_map_rgb (r, g, b);
-}
-
-// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
-//! \brief Constructor
-//! \param r Red component
-//! \param g Green component
-//! \param b Blue component
-//! \param a Alpha component
-// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
-color::impl::impl (component_type r, component_type g, component_type b, component_type a)
-{
-    obj_ = al_map_rgba (r, g, b, a);
-}
-
 // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
 //! \brief Get color RGB components
 //! \return RGB components
 // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
 std::tuple <color::component_type, color::component_type, color::component_type>
-color::impl::get_rgb () const
+color::get_rgb () const
 {
     component_type r, g, b;
     al_unmap_rgb (obj_, &r, &g, &b);
-    
+
     return std::make_tuple (r, g, b);
 }
 
@@ -105,26 +40,32 @@ color::impl::get_rgb () const
 //! \return RGBA components
 // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
 std::tuple <color::component_type, color::component_type, color::component_type, color::component_type>
-color::impl::get_rgba () const
+color::get_rgba () const
 {
     component_type r, g, b, a;
     al_unmap_rgba (obj_, &r, &g, &b, &a);
-    
+
     return std::make_tuple (r, g, b, a);
 }
 
 // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
 //! \brief Get color name
 //! \return Color name
+//!
+//! Exact matches come from the named color table. Otherwise, Allegro
+//! returns the name of the nearest color.
 // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
 std::string
-color::impl::get_name () const
+color::get_name () const
 {
   std::string name;
 
   component_type r, g, b;
   al_unmap_rgb (obj_, &r, &g, &b);
 
+  if (auto c = COLOR_NAMES.find (r, g, b))
+    return std::string (c->name);
+
   const char *s = al_color_rgb_to_name (
     static_cast <float> (r) / 255,
     static_cast <float> (g) / 255,
@@ -142,7 +83,7 @@ color::impl::get_name () const
 //! \return HTML string
 // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
 std::string
-color::impl::get_html () const
+color::get_html () const
 {
   char buffer[16] = {0};
 
@@ -159,97 +100,22 @@ color::impl::get_html () const
   return buffer;
 }
 
-// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
-//! \brief Constructor
-// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
-color::color ()
-  : impl_ (std::make_shared <impl> ())
-{
-}
-
-// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
-//! \brief Constructor
-//! \param r Red component
-//! \param g Green component
-//! \param b Blue component
-// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
-color::color (component_type r, component_type g, component_type b)
-  : impl_ (std::make_shared <impl> (r, g, b))
-{
-}
-
-// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
-//! \brief Constructor
-//! \param r Red component
-//! \param g Green component
-//! \param b Blue component
-//! \param a Alpha component
-// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
-color::color (component_type r, component_type g, component_type b, component_type a)
-  : impl_ (std::make_shared <impl> (r, g, b, a))
-{
-}
-
-// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
-//! \brief Get color RGB components
-//! \return RGB components
-// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
-std::tuple <color::component_type, color::component_type, color::component_type>
-color::get_rgb () const
-{
-    return impl_->get_rgb ();
-}
-
-// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
-//! \brief Get color RGBA components
-//! \return RGBA components
-// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
-std::tuple <color::component_type, color::component_type, color::component_type, color::component_type>
-color::get_rgba () const
-{
-    return impl_->get_rgba ();
-}
-
-// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
-//! \brief Get color name
-//! \return Color name
-// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
-std::string
-color::get_name () const
-{
-   return impl_->get_name ();
-}
-
-// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
-//! \brief Get color HTML string
-//! \return HTML string
-// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
-std::string
-color::get_html () const
-{
-   return impl_->get_html ();
-}
-
-// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
-//! \brief Get implementation pointer
-//! \return Allegro color
-// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
-ALLEGRO_COLOR
-color::get_implementation () const
-{
-   return impl_->get_implementation ();
-}
-
 // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
 //! \brief Create color by color name
 //! \param name Color name
 //! \return New color object
+//!
+//! Only names missing from the named color table are copied, as Allegro
+//! needs a NUL-terminated string.
 // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
 color
-new_color_by_name (const std::string& name)
+new_color_by_name (std::string_view name)
 {
-    float r, g, b;
-    al_color_name_to_rgb (name.c_str (), &r, &g, &b);
+    if (auto c = COLOR_NAMES.find (name))
+      return color (c->r, c->g, c->b);
+
+    float r = 0, g = 0, b = 0;
+    al_color_name_to_rgb (std::string (name).c_str (), &r, &g, &b);
     
     return color (r * 255, g * 255, b * 255);
 }
@@ -258,12 +124,20 @@ new_color_by_name (const std::string& name)
 //! \brief Create color by HTML string
 //! \param html HTML string
 //! \return New color object
+//!
+//! Only strings other than "#rrggbb" or "rrggbb" are copied, as Allegro
+//! needs a NUL-terminated string.
 // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
 color
-new_color_by_html (const std::string& html)
+new_color_by_html (std::string_view html)
 {
-    float r, g, b;
-    al_color_html_to_rgb (html.c_str (), &r, &g, &b);
+    color::component_type cr = 0, cg = 0, cb = 0;
+
+    if (detail::parse_html_color (html, cr, cg, cb))
+      return color (cr, cg, cb);
+
+    float r = 0, g = 0, b = 0;
+    al_color_html_to_rgb (std::string (html).c_str (), &r, &g, &b);
     
     return color (r * 255, g * 255, b * 255);
 }
@@ -0,0 +1,586 @@
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @author      Eduardo Aguiar <aguiar@protonmail.ch>
+// @copyright   Copyright (c) 2025 Eduardo Aguiar
+//
+// This file is part of Allegro++.
+// 
+// Allegro++ is free software: you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+// 
+// You should have received a copy of the GNU Lesser General Public License
+// along with Allegro++. If not, see <https://www.gnu.org/licenses/>.
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+#include <allegropp/color_batch.hpp>
+#include <algorithm>
+#include <cmath>
+
+#if defined (__AVX2__)
+#include <immintrin.h>
+#elif defined (__SSE2__) || defined (_M_X64) || (defined (_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define ALLEGROPP_COLOR_BATCH_SSE2
+#endif
+
+namespace allegropp
+{
+namespace
+{
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// Vector type: the widest one enabled at compile time
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+#if defined (__AVX2__)
+
+struct vec
+{
+  static constexpr std::size_t WIDTH = 8;
+  __m256 v;
+
+  vec () = default;
+  vec (__m256 x) : v (x) {}
+  vec (float x) : v (_mm256_set1_ps (x)) {}
+
+  static vec load (const float *p) { return _mm256_load_ps (p); }
+  void store (float *p) const { _mm256_store_ps (p, v); }
+};
+
+inline vec operator+ (vec a, vec b) { return _mm256_add_ps (a.v, b.v); }
+inline vec operator- (vec a, vec b) { return _mm256_sub_ps (a.v, b.v); }
+inline vec operator* (vec a, vec b) { return _mm256_mul_ps (a.v, b.v); }
+inline vec operator/ (vec a, vec b) { return _mm256_div_ps (a.v, b.v); }
+inline vec operator< (vec a, vec b) { return _mm256_cmp_ps (a.v, b.v, _CMP_LT_OQ); }
+inline vec operator> (vec a, vec b) { return _mm256_cmp_ps (a.v, b.v, _CMP_GT_OQ); }
+inline vec operator== (vec a, vec b) { return _mm256_cmp_ps (a.v, b.v, _CMP_EQ_OQ); }
+inline vec vmin (vec a, vec b) { return _mm256_min_ps (a.v, b.v); }
+inline vec vmax (vec a, vec b) { return _mm256_max_ps (a.v, b.v); }
+inline vec vfloor (vec a) { return _mm256_floor_ps (a.v); }
+inline vec select (vec mask, vec a, vec b) { return _mm256_blendv_ps (b.v, a.v, mask.v); }
+
+#elif defined (ALLEGROPP_COLOR_BATCH_SSE2)
+
+struct vec
+{
+  static constexpr std::size_t WIDTH = 4;
+  __m128 v;
+
+  vec () = default;
+  vec (__m128 x) : v (x) {}
+  vec (float x) : v (_mm_set1_ps (x)) {}
+
+  static vec load (const float *p) { return _mm_load_ps (p); }
+  void store (float *p) const { _mm_store_ps (p, v); }
+};
+
+inline vec operator+ (vec a, vec b) { return _mm_add_ps (a.v, b.v); }
+inline vec operator- (vec a, vec b) { return _mm_sub_ps (a.v, b.v); }
+inline vec operator* (vec a, vec b) { return _mm_mul_ps (a.v, b.v); }
+inline vec operator/ (vec a, vec b) { return _mm_div_ps (a.v, b.v); }
+inline vec operator< (vec a, vec b) { return _mm_cmplt_ps (a.v, b.v); }
+inline vec operator> (vec a, vec b) { return _mm_cmpgt_ps (a.v, b.v); }
+inline vec operator== (vec a, vec b) { return _mm_cmpeq_ps (a.v, b.v); }
+inline vec vmin (vec a, vec b) { return _mm_min_ps (a.v, b.v); }
+inline vec vmax (vec a, vec b) { return _mm_max_ps (a.v, b.v); }
+inline vec select (vec mask, vec a, vec b) { return _mm_or_ps (_mm_and_ps (mask.v, a.v), _mm_andnot_ps (mask.v, b.v)); }
+
+// SSE2 has no floor: truncate, then step down where truncation rounded up
+inline vec
+vfloor (vec a)
+{
+  const vec t = _mm_cvtepi32_ps (_mm_cvttps_epi32 (a.v));
+  return t - select (t > a, 1.0f, 0.0f);
+}
+
+#else
+
+struct vec
+{
+  static constexpr std::size_t WIDTH = 1;
+  float v;
+
+  vec () = default;
+  vec (float x) : v (x) {}
+
+  static vec load (const float *p) { return *p; }
+  void store (float *p) const { *p = v; }
+};
+
+inline vec operator+ (vec a, vec b) { return a.v + b.v; }
+inline vec operator- (vec a, vec b) { return a.v - b.v; }
+inline vec operator* (vec a, vec b) { return a.v * b.v; }
+inline vec operator/ (vec a, vec b) { return a.v / b.v; }
+inline bool operator< (vec a, vec b) { return a.v < b.v; }
+inline bool operator> (vec a, vec b) { return a.v > b.v; }
+inline bool operator== (vec a, vec b) { return a.v == b.v; }
+inline vec vmin (vec a, vec b) { return std::min (a.v, b.v); }
+inline vec vmax (vec a, vec b) { return std::max (a.v, b.v); }
+inline vec vfloor (vec a) { return std::floor (a.v); }
+inline vec select (bool mask, vec a, vec b) { return mask ? a : b; }
+
+#endif
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// Helpers
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+inline vec
+vmod (vec x, float m)
+{
+  return x - vfloor (x * (1.0f / m)) * m;
+}
+
+inline vec
+clamp01 (vec x)
+{
+  return vmin (vmax (x, 0.0f), 1.0f);
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Get hue (0..360), shared by RGB to HSV and RGB to HSL
+//! \param r Red component
+//! \param g Green component
+//! \param b Blue component
+//! \param mx Greatest component
+//! \param d Greatest minus least component
+//! \return Hue in degrees (0 for grays)
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+inline vec
+get_hue (vec r, vec g, vec b, vec mx, vec d)
+{
+  const auto gray = d == 0.0f;
+  const vec dd = select (gray, 1.0f, d);
+
+  vec h = select (mx == r, (g - b) / dd,
+                  select (mx == g, (b - r) / dd + 2.0f, (r - g) / dd + 4.0f));
+  h = h * 60.0f;
+  h = select (h < 0.0f, h + 360.0f, h);
+
+  return select (gray, 0.0f, h);
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// Kernels: in[] holds the source components and out[] receives the
+// converted components, one vector lane per color
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+inline void
+hsv_to_rgb (const vec *in, vec *out)
+{
+  const vec h = vmod (in[0], 360.0f) * (1.0f / 60.0f);
+  const vec vs = in[2] * in[1];
+  const float n[3] = {5.0f, 3.0f, 1.0f};
+
+  for (int i = 0; i < 3; i++)
+    {
+      const vec k = vmod (h + n[i], 6.0f);
+      out[i] = in[2] - vs * vmax (vmin (vmin (k, vec (4.0f) - k), 1.0f), 0.0f);
+    }
+}
+
+inline void
+hsl_to_rgb (const vec *in, vec *out)
+{
+  const vec h = vmod (in[0], 360.0f) * (1.0f / 30.0f);
+  const vec l = in[2];
+  const vec a = in[1] * vmin (l, vec (1.0f) - l);
+  const float n[3] = {0.0f, 8.0f, 4.0f};
+
+  for (int i = 0; i < 3; i++)
+    {
+      const vec k = vmod (h + n[i], 12.0f);
+      out[i] = l - a * vmax (vmin (vmin (k - 3.0f, vec (9.0f) - k), 1.0f), -1.0f);
+    }
+}
+
+inline void
+yuv_to_rgb (const vec *in, vec *out)
+{
+  const vec u = (in[1] * 2.0f - 1.0f) * 0.436f;
+  const vec v = (in[2] * 2.0f - 1.0f) * 0.615f;
+
+  out[0] = clamp01 (in[0] + v * 1.13983f);
+  out[1] = clamp01 (in[0] - u * 0.39465f - v * 0.58060f);
+  out[2] = clamp01 (in[0] + u * 2.03211f);
+}
+
+inline void
+cmyk_to_rgb (const vec *in, vec *out)
+{
+  const vec k = vec (1.0f) - in[3];
+
+  out[0] = (vec (1.0f) - in[0]) * k;
+  out[1] = (vec (1.0f) - in[1]) * k;
+  out[2] = (vec (1.0f) - in[2]) * k;
+}
+
+inline void
+rgb_to_hsv (const vec *in, vec *out)
+{
+  const vec mx = vmax (in[0], vmax (in[1], in[2]));
+  const vec d = mx - vmin (in[0], vmin (in[1], in[2]));
+
+  out[0] = get_hue (in[0], in[1], in[2], mx, d);
+  out[1] = select (mx > 0.0f, d / select (mx > 0.0f, mx, 1.0f), 0.0f);
+  out[2] = mx;
+}
+
+inline void
+rgb_to_hsl (const vec *in, vec *out)
+{
+  const vec mx = vmax (in[0], vmax (in[1], in[2]));
+  const vec mn = vmin (in[0], vmin (in[1], in[2]));
+  const vec d = mx - mn;
+  const vec l = (mx + mn) * 0.5f;
+  const vec sum = select (l > 0.5f, vec (2.0f) - mx - mn, mx + mn);
+
+  out[0] = get_hue (in[0], in[1], in[2], mx, d);
+  out[1] = select (d == 0.0f, 0.0f, d / select (d == 0.0f, 1.0f, sum));
+  out[2] = l;
+}
+
+inline void
+rgb_to_yuv (const vec *in, vec *out)
+{
+  const vec r = in[0], g = in[1], b = in[2];
+  const vec u = r * -0.14713f + g * -0.28886f + b * 0.436f;
+  const vec v = r * 0.615f + g * -0.51499f + b * -0.10001f;
+
+  out[0] = r * 0.299f + g * 0.587f + b * 0.114f;
+  out[1] = (u / 0.436f + 1.0f) * 0.5f;
+  out[2] = (v / 0.615f + 1.0f) * 0.5f;
+}
+
+inline void
+rgb_to_cmyk (const vec *in, vec *out)
+{
+  const vec mx = vmax (in[0], vmax (in[1], in[2]));
+  const auto black = mx == 0.0f;
+  const vec m = select (black, 1.0f, mx);
+
+  out[0] = select (black, 0.0f, (mx - in[0]) / m);
+  out[1] = select (black, 0.0f, (mx - in[1]) / m);
+  out[2] = select (black, 0.0f, (mx - in[2]) / m);
+  out[3] = vec (1.0f) - mx;
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Run a kernel over count colors, BLOCK colors at a time
+//! \param count Number of colors
+//! \param load Functor loading the IN components of color i into float *
+//! \param store Functor storing the OUT components of color i from float *
+//!
+//! Packed colors are transposed into per-component arrays, so the kernel
+//! works on whole vectors. The last block is padded with zeros.
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+template <std::size_t IN, std::size_t OUT, void (*KERNEL) (const vec *, vec *), typename Load, typename Store>
+void
+convert (std::size_t count, Load load, Store store)
+{
+  constexpr std::size_t BLOCK = 64;
+
+  alignas (32) float src[IN][BLOCK];
+  alignas (32) float dst[OUT][BLOCK];
+
+  for (std::size_t first = 0; first < count; first += BLOCK)
+    {
+      const std::size_t n = std::min (BLOCK, count - first);
+      const std::size_t lanes = (n + vec::WIDTH - 1) / vec::WIDTH * vec::WIDTH;
+
+      for (std::size_t i = 0; i < n; i++)
+        {
+          float c[IN];
+          load (first + i, c);
+
+          for (std::size_t j = 0; j < IN; j++)
+            src[j][i] = c[j];
+        }
+
+      for (std::size_t i = n; i < lanes; i++)
+        for (std::size_t j = 0; j < IN; j++)
+          src[j][i] = 0.0f;
+
+      for (std::size_t i = 0; i < lanes; i += vec::WIDTH)
+        {
+          vec in[IN] = {};
+          vec out[OUT] = {};
+
+          for (std::size_t j = 0; j < IN; j++)
+            in[j] = vec::load (&src[j][i]);
+
+          KERNEL (in, out);
+
+          for (std::size_t j = 0; j < OUT; j++)
+            out[j].store (&dst[j][i]);
+        }
+
+      for (std::size_t i = 0; i < n; i++)
+        {
+          float c[OUT];
+
+          for (std::size_t j = 0; j < OUT; j++)
+            c[j] = dst[j][i];
+
+          store (first + i, c);
+        }
+    }
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Convert packed components to RGBA
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+template <std::size_t IN, void (*KERNEL) (const vec *, vec *)>
+void
+from_space (const float *src, ALLEGRO_COLOR *dst, std::size_t count)
+{
+  convert <IN, 3, KERNEL> (
+    count,
+    [src] (std::size_t i, float *c) { std::copy_n (src + i * IN, IN, c); },
+    [dst] (std::size_t i, const float *c) { dst[i] = ALLEGRO_COLOR {c[0], c[1], c[2], 1.0f}; }
+  );
+}
+
+// Bytes are truncated, as color's constructors do with new_color_by_* results
+template <std::size_t IN, void (*KERNEL) (const vec *, vec *)>
+void
+from_space (const float *src, std::uint8_t *dst, std::size_t count)
+{
+  convert <IN, 3, KERNEL> (
+    count,
+    [src] (std::size_t i, float *c) { std::copy_n (src + i * IN, IN, c); },
+    [dst] (std::size_t i, const float *c)
+    {
+      for (std::size_t j = 0; j < 3; j++)
+        dst[i * 4 + j] = std::uint8_t (std::min (std::max (c[j], 0.0f), 1.0f) * 255.0f);
+
+      dst[i * 4 + 3] = 255;
+    }
+  );
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Convert RGBA to packed components
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+template <std::size_t OUT, void (*KERNEL) (const vec *, vec *)>
+void
+to_space (const ALLEGRO_COLOR *src, float *dst, std::size_t count)
+{
+  convert <3, OUT, KERNEL> (
+    count,
+    [src] (std::size_t i, float *c) { c[0] = src[i].r; c[1] = src[i].g; c[2] = src[i].b; },
+    [dst] (std::size_t i, const float *c) { std::copy_n (c, OUT, dst + i * OUT); }
+  );
+}
+
+template <std::size_t OUT, void (*KERNEL) (const vec *, vec *)>
+void
+to_space (const std::uint8_t *src, float *dst, std::size_t count)
+{
+  convert <3, OUT, KERNEL> (
+    count,
+    [src] (std::size_t i, float *c)
+    {
+      for (std::size_t j = 0; j < 3; j++)
+        c[j] = src[i * 4 + j] / 255.0f;
+    },
+    [dst] (std::size_t i, const float *c) { std::copy_n (c, OUT, dst + i * OUT); }
+  );
+}
+
+} // namespace
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Convert HSV colors to RGBA
+//! \param hsv HSV components (hue in degrees, saturation and value 0..1)
+//! \param rgba Allegro colors
+//! \param count Number of colors
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+void
+colors_from_hsv (const float *hsv, ALLEGRO_COLOR *rgba, std::size_t count)
+{
+  from_space <3, hsv_to_rgb> (hsv, rgba, count);
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Convert HSV colors to 8-bit RGBA
+//! \param hsv HSV components (hue in degrees, saturation and value 0..1)
+//! \param rgba RGBA bytes
+//! \param count Number of colors
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+void
+colors_from_hsv (const float *hsv, std::uint8_t *rgba, std::size_t count)
+{
+  from_space <3, hsv_to_rgb> (hsv, rgba, count);
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Convert HSL colors to RGBA
+//! \param hsl HSL components (hue in degrees, saturation and lightness 0..1)
+//! \param rgba Allegro colors
+//! \param count Number of colors
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+void
+colors_from_hsl (const float *hsl, ALLEGRO_COLOR *rgba, std::size_t count)
+{
+  from_space <3, hsl_to_rgb> (hsl, rgba, count);
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Convert HSL colors to 8-bit RGBA
+//! \param hsl HSL components (hue in degrees, saturation and lightness 0..1)
+//! \param rgba RGBA bytes
+//! \param count Number of colors
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+void
+colors_from_hsl (const float *hsl, std::uint8_t *rgba, std::size_t count)
+{
+  from_space <3, hsl_to_rgb> (hsl, rgba, count);
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Convert YUV colors to RGBA
+//! \param yuv YUV components (0..1)
+//! \param rgba Allegro colors
+//! \param count Number of colors
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+void
+colors_from_yuv (const float *yuv, ALLEGRO_COLOR *rgba, std::size_t count)
+{
+  from_space <3, yuv_to_rgb> (yuv, rgba, count);
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Convert YUV colors to 8-bit RGBA
+//! \param yuv YUV components (0..1)
+//! \param rgba RGBA bytes
+//! \param count Number of colors
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+void
+colors_from_yuv (const float *yuv, std::uint8_t *rgba, std::size_t count)
+{
+  from_space <3, yuv_to_rgb> (yuv, rgba, count);
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Convert CMYK colors to RGBA
+//! \param cmyk CMYK components (0..1)
+//! \param rgba Allegro colors
+//! \param count Number of colors
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+void
+colors_from_cmyk (const float *cmyk, ALLEGRO_COLOR *rgba, std::size_t count)
+{
+  from_space <4, cmyk_to_rgb> (cmyk, rgba, count);
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Convert CMYK colors to 8-bit RGBA
+//! \param cmyk CMYK components (0..1)
+//! \param rgba RGBA bytes
+//! \param count Number of colors
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+void
+colors_from_cmyk (const float *cmyk, std::uint8_t *rgba, std::size_t count)
+{
+  from_space <4, cmyk_to_rgb> (cmyk, rgba, count);
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Convert RGBA colors to HSV
+//! \param rgba Allegro colors
+//! \param hsv HSV components (hue in degrees, saturation and value 0..1)
+//! \param count Number of colors
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+void
+colors_to_hsv (const ALLEGRO_COLOR *rgba, float *hsv, std::size_t count)
+{
+  to_space <3, rgb_to_hsv> (rgba, hsv, count);
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Convert 8-bit RGBA colors to HSV
+//! \param rgba RGBA bytes
+//! \param hsv HSV components (hue in degrees, saturation and value 0..1)
+//! \param count Number of colors
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+void
+colors_to_hsv (const std::uint8_t *rgba, float *hsv, std::size_t count)
+{
+  to_space <3, rgb_to_hsv> (rgba, hsv, count);
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Convert RGBA colors to HSL
+//! \param rgba Allegro colors
+//! \param hsl HSL components (hue in degrees, saturation and lightness 0..1)
+//! \param count Number of colors
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+void
+colors_to_hsl (const ALLEGRO_COLOR *rgba, float *hsl, std::size_t count)
+{
+  to_space <3, rgb_to_hsl> (rgba, hsl, count);
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Convert 8-bit RGBA colors to HSL
+//! \param rgba RGBA bytes
+//! \param hsl HSL components (hue in degrees, saturation and lightness 0..1)
+//! \param count Number of colors
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+void
+colors_to_hsl (const std::uint8_t *rgba, float *hsl, std::size_t count)
+{
+  to_space <3, rgb_to_hsl> (rgba, hsl, count);
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Convert RGBA colors to YUV
+//! \param rgba Allegro colors
+//! \param yuv YUV components (0..1)
+//! \param count Number of colors
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+void
+colors_to_yuv (const ALLEGRO_COLOR *rgba, float *yuv, std::size_t count)
+{
+  to_space <3, rgb_to_yuv> (rgba, yuv, count);
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Convert 8-bit RGBA colors to YUV
+//! \param rgba RGBA bytes
+//! \param yuv YUV components (0..1)
+//! \param count Number of colors
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+void
+colors_to_yuv (const std::uint8_t *rgba, float *yuv, std::size_t count)
+{
+  to_space <3, rgb_to_yuv> (rgba, yuv, count);
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Convert RGBA colors to CMYK
+//! \param rgba Allegro colors
+//! \param cmyk CMYK components (0..1)
+//! \param count Number of colors
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+void
+colors_to_cmyk (const ALLEGRO_COLOR *rgba, float *cmyk, std::size_t count)
+{
+  to_space <4, rgb_to_cmyk> (rgba, cmyk, count);
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Convert 8-bit RGBA colors to CMYK
+//! \param rgba RGBA bytes
+//! \param cmyk CMYK components (0..1)
+//! \param count Number of colors
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+void
+colors_to_cmyk (const std::uint8_t *rgba, float *cmyk, std::size_t count)
+{
+  to_space <4, rgb_to_cmyk> (rgba, cmyk, count);
+}
+
+} // namespace allegropp
@@ -0,0 +1,391 @@
+#ifndef ALLEGROPP_COLOR_NAMES
+#define ALLEGROPP_COLOR_NAMES
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @author      Eduardo Aguiar <aguiar@protonmail.ch>
+// @copyright   Copyright (c) 2025 Eduardo Aguiar
+//
+// This file is part of Allegro++.
+// 
+// Allegro++ is free software: you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+// 
+// You should have received a copy of the GNU Lesser General Public License
+// along with Allegro++. If not, see <https://www.gnu.org/licenses/>.
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <string_view>
+
+namespace allegropp
+{
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Named color
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+struct named_color
+{
+  std::string_view name;
+  std::uint8_t r;
+  std::uint8_t g;
+  std::uint8_t b;
+};
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief CSS named colors, plus Allegro's "purwablue", sorted by name
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+constexpr named_color NAMED_COLORS[] =
+{
+    {"aliceblue", 240, 248, 255},
+    {"antiquewhite", 250, 235, 215},
+    {"aqua", 0, 255, 255},
+    {"aquamarine", 127, 255, 212},
+    {"azure", 240, 255, 255},
+    {"beige", 245, 245, 220},
+    {"bisque", 255, 228, 196},
+    {"black", 0, 0, 0},
+    {"blanchedalmond", 255, 235, 205},
+    {"blue", 0, 0, 255},
+    {"blueviolet", 138, 43, 226},
+    {"brown", 165, 42, 42},
+    {"burlywood", 222, 184, 135},
+    {"cadetblue", 95, 158, 160},
+    {"chartreuse", 127, 255, 0},
+    {"chocolate", 210, 105, 30},
+    {"coral", 255, 127, 80},
+    {"cornflowerblue", 100, 149, 237},
+    {"cornsilk", 255, 248, 220},
+    {"crimson", 220, 20, 60},
+    {"cyan", 0, 255, 255},
+    {"darkblue", 0, 0, 139},
+    {"darkcyan", 0, 139, 139},
+    {"darkgoldenrod", 184, 134, 11},
+    {"darkgray", 169, 169, 169},
+    {"darkgreen", 0, 100, 0},
+    {"darkgrey", 169, 169, 169},
+    {"darkkhaki", 189, 183, 107},
+    {"darkmagenta", 139, 0, 139},
+    {"darkolivegreen", 85, 107, 47},
+    {"darkorange", 255, 140, 0},
+    {"darkorchid", 153, 50, 204},
+    {"darkred", 139, 0, 0},
+    {"darksalmon", 233, 150, 122},
+    {"darkseagreen", 143, 188, 143},
+    {"darkslateblue", 72, 61, 139},
+    {"darkslategray", 47, 79, 79},
+    {"darkslategrey", 47, 79, 79},
+    {"darkturquoise", 0, 206, 209},
+    {"darkviolet", 148, 0, 211},
+    {"deeppink", 255, 20, 147},
+    {"deepskyblue", 0, 191, 255},
+    {"dimgray", 105, 105, 105},
+    {"dimgrey", 105, 105, 105},
+    {"dodgerblue", 30, 144, 255},
+    {"firebrick", 178, 34, 34},
+    {"floralwhite", 255, 250, 240},
+    {"forestgreen", 34, 139, 34},
+    {"fuchsia", 255, 0, 255},
+    {"gainsboro", 220, 220, 220},
+    {"ghostwhite", 248, 248, 255},
+    {"gold", 255, 215, 0},
+    {"goldenrod", 218, 165, 32},
+    {"gray", 128, 128, 128},
+    {"green", 0, 128, 0},
+    {"greenyellow", 173, 255, 47},
+    {"grey", 128, 128, 128},
+    {"honeydew", 240, 255, 240},
+    {"hotpink", 255, 105, 180},
+    {"indianred", 205, 92, 92},
+    {"indigo", 75, 0, 130},
+    {"ivory", 255, 255, 240},
+    {"khaki", 240, 230, 140},
+    {"lavender", 230, 230, 250},
+    {"lavenderblush", 255, 240, 245},
+    {"lawngreen", 124, 252, 0},
+    {"lemonchiffon", 255, 250, 205},
+    {"lightblue", 173, 216, 230},
+    {"lightcoral", 240, 128, 128},
+    {"lightcyan", 224, 255, 255},
+    {"lightgoldenrodyellow", 250, 250, 210},
+    {"lightgray", 211, 211, 211},
+    {"lightgreen", 144, 238, 144},
+    {"lightgrey", 211, 211, 211},
+    {"lightpink", 255, 182, 193},
+    {"lightsalmon", 255, 160, 122},
+    {"lightseagreen", 32, 178, 170},
+    {"lightskyblue", 135, 206, 250},
+    {"lightslategray", 119, 136, 153},
+    {"lightslategrey", 119, 136, 153},
+    {"lightsteelblue", 176, 196, 222},
+    {"lightyellow", 255, 255, 224},
+    {"lime", 0, 255, 0},
+    {"limegreen", 50, 205, 50},
+    {"linen", 250, 240, 230},
+    {"magenta", 255, 0, 255},
+    {"maroon", 128, 0, 0},
+    {"mediumaquamarine", 102, 205, 170},
+    {"mediumblue", 0, 0, 205},
+    {"mediumorchid", 186, 85, 211},
+    {"mediumpurple", 147, 112, 219},
+    {"mediumseagreen", 60, 179, 113},
+    {"mediumslateblue", 123, 104, 238},
+    {"mediumspringgreen", 0, 250, 154},
+    {"mediumturquoise", 72, 209, 204},
+    {"mediumvioletred", 199, 21, 133},
+    {"midnightblue", 25, 25, 112},
+    {"mintcream", 245, 255, 250},
+    {"mistyrose", 255, 228, 225},
+    {"moccasin", 255, 228, 181},
+    {"navajowhite", 255, 222, 173},
+    {"navy", 0, 0, 128},
+    {"oldlace", 253, 245, 230},
+    {"olive", 128, 128, 0},
+    {"olivedrab", 107, 142, 35},
+    {"orange", 255, 165, 0},
+    {"orangered", 255, 69, 0},
+    {"orchid", 218, 112, 214},
+    {"palegoldenrod", 238, 232, 170},
+    {"palegreen", 152, 251, 152},
+    {"paleturquoise", 175, 238, 238},
+    {"palevioletred", 219, 112, 147},
+    {"papayawhip", 255, 239, 213},
+    {"peachpuff", 255, 218, 185},
+    {"peru", 205, 133, 63},
+    {"pink", 255, 192, 203},
+    {"plum", 221, 160, 221},
+    {"powderblue", 176, 224, 230},
+    {"purple", 128, 0, 128},
+    {"purwablue", 155, 207, 255},
+    {"rebeccapurple", 102, 51, 153},
+    {"red", 255, 0, 0},
+    {"rosybrown", 188, 143, 143},
+    {"royalblue", 65, 105, 225},
+    {"saddlebrown", 139, 69, 19},
+    {"salmon", 250, 128, 114},
+    {"sandybrown", 244, 164, 96},
+    {"seagreen", 46, 139, 87},
+    {"seashell", 255, 245, 238},
+    {"sienna", 160, 82, 45},
+    {"silver", 192, 192, 192},
+    {"skyblue", 135, 206, 235},
+    {"slateblue", 106, 90, 205},
+    {"slategray", 112, 128, 144},
+    {"slategrey", 112, 128, 144},
+    {"snow", 255, 250, 250},
+    {"springgreen", 0, 255, 127},
+    {"steelblue", 70, 130, 180},
+    {"tan", 210, 180, 140},
+    {"teal", 0, 128, 128},
+    {"thistle", 216, 191, 216},
+    {"tomato", 255, 99, 71},
+    {"turquoise", 64, 224, 208},
+    {"violet", 238, 130, 238},
+    {"wheat", 245, 222, 179},
+    {"white", 255, 255, 255},
+    {"whitesmoke", 245, 245, 245},
+    {"yellow", 255, 255, 0},
+    {"yellowgreen", 154, 205, 50},
+};
+
+constexpr std::size_t NAMED_COLOR_COUNT = std::size (NAMED_COLORS);
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Constant-time lookups into NAMED_COLORS, built at compile time
+//!
+//! Names are found through a perfect hash (hash and displace): the name
+//! hash selects a bucket, and each bucket has a seed remixing the hash of
+//! its names into distinct free slots. A lookup hashes the name once and
+//! compares a single entry.
+//!
+//! Colors are found through an open-addressed table keyed by 0xRRGGBB,
+//! holding the first name (alphabetically) of each color, as Allegro's
+//! al_color_rgb_to_name returns for exact matches.
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+class color_name_table
+{
+public:
+  static constexpr std::size_t BUCKETS = 64;
+  static constexpr std::size_t SLOTS = 256;
+  static constexpr std::size_t RGB_SLOTS = 512;
+  static constexpr std::uint8_t EMPTY = 0xff;
+
+  static_assert (NAMED_COLOR_COUNT < EMPTY, "too many named colors");
+
+  // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+  //! \brief Constructor: builds both tables
+  // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+  constexpr color_name_table ()
+  {
+    for (auto& s : slots_)
+      s = EMPTY;
+
+    for (auto& s : rgb_slots_)
+      s = EMPTY;
+
+    // Place buckets from largest to smallest
+    std::size_t sizes[BUCKETS] = {};
+
+    for (std::size_t i = 0; i < NAMED_COLOR_COUNT; i++)
+      sizes[hash (NAMED_COLORS[i].name) % BUCKETS]++;
+
+    for (std::size_t size = NAMED_COLOR_COUNT; size > 0; size--)
+      for (std::size_t b = 0; b < BUCKETS; b++)
+        if (sizes[b] == size)
+          place_bucket (b);
+
+    // Reverse table, keeping the first name of each color
+    for (std::size_t i = 0; i < NAMED_COLOR_COUNT; i++)
+      {
+        const std::uint32_t key = get_rgb (NAMED_COLORS[i]);
+        std::size_t s = rgb_hash (key);
+
+        while (rgb_slots_[s] != EMPTY && get_rgb (NAMED_COLORS[rgb_slots_[s]]) != key)
+          s = (s + 1) % RGB_SLOTS;
+
+        if (rgb_slots_[s] == EMPTY)
+          rgb_slots_[s] = std::uint8_t (i);
+      }
+  }
+
+  // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+  //! \brief Find color by name
+  //! \param name Color name
+  //! \return Named color, or nullptr if not found
+  // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+  constexpr const named_color *
+  find (std::string_view name) const
+  {
+    const std::uint32_t h = hash (name);
+    const std::uint8_t i = slots_[get_slot (h, displacement_[h % BUCKETS])];
+
+    if (i != EMPTY && NAMED_COLORS[i].name == name)
+      return &NAMED_COLORS[i];
+
+    return nullptr;
+  }
+
+  // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+  //! \brief Find color by exact RGB value
+  //! \param r Red component
+  //! \param g Green component
+  //! \param b Blue component
+  //! \return Named color, or nullptr if not found
+  // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+  constexpr const named_color *
+  find (std::uint8_t r, std::uint8_t g, std::uint8_t b) const
+  {
+    const std::uint32_t key = (std::uint32_t (r) << 16) | (std::uint32_t (g) << 8) | b;
+
+    for (std::size_t s = rgb_hash (key); rgb_slots_[s] != EMPTY; s = (s + 1) % RGB_SLOTS)
+      if (get_rgb (NAMED_COLORS[rgb_slots_[s]]) == key)
+        return &NAMED_COLORS[rgb_slots_[s]];
+
+    return nullptr;
+  }
+
+private:
+  // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+  //! \brief FNV-1a string hash
+  // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+  static constexpr std::uint32_t
+  hash (std::string_view s)
+  {
+    std::uint32_t h = 2166136261u;
+
+    for (char c : s)
+      {
+        h ^= std::uint8_t (c);
+        h *= 16777619u;
+      }
+
+    return h;
+  }
+
+  // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+  //! \brief Remix a name hash with a bucket seed into a slot
+  // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+  static constexpr std::size_t
+  get_slot (std::uint32_t h, std::uint32_t seed)
+  {
+    h ^= seed * 0x9e3779b9u;
+    h ^= h >> 16;
+    h *= 0x45d9f3bu;
+    h ^= h >> 16;
+
+    return h % SLOTS;
+  }
+
+  static constexpr std::size_t
+  rgb_hash (std::uint32_t key)
+  {
+    return (key * 2654435761u) >> 23;   // 9 bits: RGB_SLOTS
+  }
+
+  static constexpr std::uint32_t
+  get_rgb (const named_color& c)
+  {
+    return (std::uint32_t (c.r) << 16) | (std::uint32_t (c.g) << 8) | c.b;
+  }
+
+  // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+  //! \brief Find a seed placing every name of a bucket in a free slot
+  //! \param b Bucket
+  // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+  constexpr void
+  place_bucket (std::size_t b)
+  {
+    for (std::uint32_t seed = 1;; seed++)
+      {
+        std::size_t placed[NAMED_COLOR_COUNT] = {};
+        std::size_t count = 0;
+        bool ok = true;
+
+        for (std::size_t i = 0; i < NAMED_COLOR_COUNT && ok; i++)
+          if (hash (NAMED_COLORS[i].name) % BUCKETS == b)
+            {
+              const std::size_t s = get_slot (hash (NAMED_COLORS[i].name), seed);
+
+              if (slots_[s] == EMPTY)
+                {
+                  slots_[s] = std::uint8_t (i);
+                  placed[count++] = s;
+                }
+
+              else
+                ok = false;
+            }
+
+        if (ok)
+          {
+            displacement_[b] = seed;
+            return;
+          }
+
+        while (count > 0)
+          slots_[placed[--count]] = EMPTY;
+      }
+  }
+
+  std::uint32_t displacement_[BUCKETS] = {};    //!< Second hash seed, per bucket
+  std::uint8_t slots_[SLOTS] = {};              //!< Name index, per name slot
+  std::uint8_t rgb_slots_[RGB_SLOTS] = {};      //!< Name index, per color slot
+};
+
+//! \brief Named color lookup tables
+inline constexpr color_name_table COLOR_NAMES {};
+
+static_assert (COLOR_NAMES.find ("aliceblue") == &NAMED_COLORS[0], "bad color name table");
+static_assert (COLOR_NAMES.find ("yellowgreen") == &NAMED_COLORS[NAMED_COLOR_COUNT - 1], "bad color name table");
+static_assert (COLOR_NAMES.find ("nosuchcolor") == nullptr, "bad color name table");
+static_assert (COLOR_NAMES.find (0, 255, 255)->name == "aqua", "bad color name table");
+
+} // namespace allegropp
+
+#endif
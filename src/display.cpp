@@ -20,6 +20,8 @@
 #include <allegropp/display.hpp>
 #include <allegropp/allegropp.hpp>
 #include <allegro5/allegro.h>
+#include <stdexcept>
+#include <string>
 
 namespace allegropp
 {
@@ -34,7 +36,7 @@ public:
   // Constructors and destructor
   // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
   impl () = default;
-  impl (std::size_t, std::size_t);
+  impl (std::size_t, std::size_t, int);
   impl (const impl&) = delete;
   impl (impl&&) = delete;
   ~impl ();
@@ -60,7 +62,7 @@ public:
   int get_height () const;
   void flip ();
   void resize (std::size_t, std::size_t);
-  void set_window_title (const std::string&);
+  void set_window_title (std::string_view);
   void set_window_position (std::size_t, std::size_t);
   std::pair <int, int> get_window_position () const;
   event_source get_event_source () const;
@@ -74,11 +76,16 @@ private:
 //! \brief Constructor
 //! \param width Display width in pixels
 //! \param height Display height in pixels
+//! \param flags Display flags, added to the new display flags (ALLEGRO_PROGRAMMABLE_PIPELINE, etc)
 // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
-display::impl::impl (std::size_t width, std::size_t height)
+display::impl::impl (std::size_t width, std::size_t height, int flags)
 {
   allegropp::init ();       // Initialize Allegro main system
+
+  const int new_flags = al_get_new_display_flags ();
+  al_set_new_display_flags (new_flags | flags);
   obj_ = al_create_display (width, height);
+  al_set_new_display_flags (new_flags);
 }
 
 // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
@@ -145,14 +152,17 @@ display::impl::resize (std::size_t width, std::size_t height)
 // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
 //! \brief Set window title
 //! \param title Window title
+//!
+//! Allegro has no length-delimited variant of al_set_window_title, so the
+//! title is copied into a NUL-terminated string.
 // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
 void
-display::impl::set_window_title (const std::string& title)
+display::impl::set_window_title (std::string_view title)
 {
     if (!obj_)
         throw std::invalid_argument ("null display object");
 
-    al_set_window_title (obj_, title.c_str ());
+    al_set_window_title (obj_, std::string (title).c_str ());
 }
 
 // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
@@ -210,9 +220,10 @@ display::display ()
 //! \brief Constructor
 //! \param width Display width in pixels
 //! \param height Display height in pixels
+//! \param flags Display flags, added to the new display flags (ALLEGRO_PROGRAMMABLE_PIPELINE, etc)
 // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
-display::display (std::size_t width, std::size_t height)
-  : impl_ (std::make_shared <impl> (width, height))
+display::display (std::size_t width, std::size_t height, int flags)
+  : impl_ (std::make_shared <impl> (width, height, flags))
 {
 }
 
@@ -270,7 +281,7 @@ display::resize (std::size_t width, std::size_t height)
 //! \param title Window title
 // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
 void
-display::set_window_title (const std::string& title)
+display::set_window_title (std::string_view title)
 {
   impl_->set_window_title (title);
 }
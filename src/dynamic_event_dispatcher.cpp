@@ -0,0 +1,286 @@
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @author      Eduardo Aguiar <aguiar@protonmail.ch>
+// @copyright   Copyright (c) 2025 Eduardo Aguiar
+//
+// This file is part of Allegro++.
+// 
+// Allegro++ is free software: you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+// 
+// You should have received a copy of the GNU Lesser General Public License
+// along with Allegro++. If not, see <https://www.gnu.org/licenses/>.
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+#include <allegropp/dynamic_event_dispatcher.hpp>
+#include <algorithm>
+#include <stdexcept>
+#include <unordered_map>
+#include <vector>
+
+namespace allegropp
+{
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief <i>dynamic_event_dispatcher</i> implementation class
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+class dynamic_event_dispatcher::impl
+{
+public:
+
+  // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+  // Constructors and destructor
+  // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+  impl ();
+  impl (const impl&) = delete;
+  impl (impl&&) = delete;
+
+  // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+  // Operators
+  // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+  impl& operator= (const impl&) = delete;
+  impl& operator= (impl&&) = delete;
+
+  // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+  // Prototypes
+  // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+  handler_id add_handler (ALLEGRO_EVENT_TYPE, handler_type);
+  bool remove_handler (handler_id);
+  bool dispatch (const ALLEGRO_EVENT&) const;
+  std::size_t dispatch_pending (event_queue&) const;
+
+  // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+  //! \brief Get number of handlers
+  //! \return Number of handlers
+  // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+  std::size_t
+  get_handler_count () const noexcept
+  {
+    return handler_count_;
+  }
+
+private:
+  //! \brief Handler list entry
+  struct entry
+  {
+    handler_id id;
+    handler_type handler;
+  };
+
+  using handler_list = std::vector <entry>;
+
+  //! \brief Built-in event types are below this value, and use a direct table
+  static constexpr ALLEGRO_EVENT_TYPE DIRECT_TYPES = 64;
+
+  //! \brief Number of events taken from the queue at a time
+  static constexpr std::size_t BATCH_SIZE = 64;
+
+  // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+  //! \brief Find handler list of an event type
+  //! \param type Event type
+  //! \return Handler list, or nullptr if there is none
+  // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+  const handler_list *
+  find (ALLEGRO_EVENT_TYPE type) const
+  {
+    if (type < DIRECT_TYPES)
+      return &direct_[type];
+
+    auto iter = other_.find (type);
+    return iter != other_.end () ? &iter->second : nullptr;
+  }
+
+  //! \brief Handlers of built-in event types, indexed by type
+  std::vector <handler_list> direct_;
+
+  //! \brief Handlers of other event types (user events)
+  std::unordered_map <ALLEGRO_EVENT_TYPE, handler_list> other_;
+
+  //! \brief Next handler ID
+  handler_id next_id_ = 1;
+
+  //! \brief Number of handlers
+  std::size_t handler_count_ = 0;
+};
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Constructor
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+dynamic_event_dispatcher::impl::impl ()
+  : direct_ (DIRECT_TYPES)
+{
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Add handler
+//! \param type Event type
+//! \param handler Handler
+//! \return Handler ID
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+dynamic_event_dispatcher::handler_id
+dynamic_event_dispatcher::impl::add_handler (ALLEGRO_EVENT_TYPE type, handler_type handler)
+{
+  if (!handler)
+    throw std::invalid_argument ("empty event handler");
+
+  handler_list& handlers = type < DIRECT_TYPES ? direct_[type] : other_[type];
+  const handler_id id = next_id_++;
+
+  handlers.push_back ({id, std::move (handler)});
+  handler_count_++;
+
+  return id;
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Remove handler
+//! \param id Handler ID
+//! \return true if the handler was found
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+bool
+dynamic_event_dispatcher::impl::remove_handler (handler_id id)
+{
+  auto erase = [this, id](handler_list& handlers)
+  {
+    auto iter = std::find_if (handlers.begin (), handlers.end (), [id](const entry& e) { return e.id == id; });
+
+    if (iter == handlers.end ())
+      return false;
+
+    handlers.erase (iter);
+    handler_count_--;
+    return true;
+  };
+
+  for (auto& handlers : direct_)
+    if (erase (handlers))
+      return true;
+
+  for (auto iter = other_.begin (); iter != other_.end (); ++iter)
+    if (erase (iter->second))
+      {
+        if (iter->second.empty ())
+          other_.erase (iter);
+
+        return true;
+      }
+
+  return false;
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Dispatch event
+//! \param event Event
+//! \return true if a handler took the event
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+bool
+dynamic_event_dispatcher::impl::dispatch (const ALLEGRO_EVENT& event) const
+{
+  const handler_list *handlers = find (event.type);
+
+  if (!handlers || handlers->empty ())
+    return false;
+
+  for (const auto& e : *handlers)
+    e.handler (event);
+
+  return true;
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Dispatch all pending events of a queue
+//! \param queue Event queue
+//! \return Number of events dispatched
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+std::size_t
+dynamic_event_dispatcher::impl::dispatch_pending (event_queue& queue) const
+{
+  ALLEGRO_EVENT events[BATCH_SIZE];
+  std::size_t total = 0;
+  std::size_t count;
+
+  do
+    {
+      count = queue.drain (events);
+
+      for (std::size_t i = 0; i < count; i++)
+        dispatch (events[i]);
+
+      total += count;
+    }
+  while (count == BATCH_SIZE);
+
+  return total;
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Constructor
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+dynamic_event_dispatcher::dynamic_event_dispatcher ()
+  : impl_ (std::make_shared <impl> ())
+{
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Add handler
+//! \param type Event type
+//! \param handler Handler, called with the whole event
+//! \return Handler ID, for remove_handler
+//! \throws std::invalid_argument If handler is empty
+//!
+//! Handlers of the same event type are called in the order they were added.
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+dynamic_event_dispatcher::handler_id
+dynamic_event_dispatcher::add_handler (ALLEGRO_EVENT_TYPE type, handler_type handler)
+{
+  return impl_->add_handler (type, std::move (handler));
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Remove handler
+//! \param id Handler ID, returned by add_handler
+//! \return true if the handler was found
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+bool
+dynamic_event_dispatcher::remove_handler (handler_id id)
+{
+  return impl_->remove_handler (id);
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Get number of handlers
+//! \return Number of handlers
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+std::size_t
+dynamic_event_dispatcher::get_handler_count () const
+{
+  return impl_->get_handler_count ();
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Dispatch event to the handlers of its type
+//! \param event Event
+//! \return true if a handler took the event
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+bool
+dynamic_event_dispatcher::dispatch (const ALLEGRO_EVENT& event) const
+{
+  return impl_->dispatch (event);
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Dispatch all pending events of a queue, without waiting
+//! \param queue Event queue
+//! \return Number of events dispatched
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+std::size_t
+dynamic_event_dispatcher::dispatch_pending (event_queue& queue) const
+{
+  return impl_->dispatch_pending (queue);
+}
+
+} // namespace allegropp
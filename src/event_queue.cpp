@@ -20,6 +20,7 @@
 #include <allegropp/event_queue.hpp>
 #include <allegropp/keyboard.hpp>
 #include <allegropp/mouse.hpp>
+#include <stdexcept>
 
 namespace allegropp
 {
@@ -52,6 +53,10 @@ public:
   void add_timer_events (const timer&);
   void add_display_events (const display&);
   void get_event (ALLEGRO_EVENT&);
+  bool try_get_event (ALLEGRO_EVENT&);
+  bool wait_for_event_until (ALLEGRO_EVENT&, std::chrono::steady_clock::time_point);
+  bool peek (ALLEGRO_EVENT&) const;
+  std::size_t drain (ALLEGRO_EVENT *, std::size_t);
 
 private:
   //! \brief Allegro event_queue object
@@ -126,6 +131,68 @@ event_queue::impl::get_event (ALLEGRO_EVENT& event)
   al_wait_for_event (obj_, &event);
 }
 
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Get event, if there is one pending
+//! \param event Reference to event
+//! \return true if an event was got, false if the queue was empty
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+bool
+event_queue::impl::try_get_event (ALLEGRO_EVENT& event)
+{
+  return al_get_next_event (obj_, &event);
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Wait for event until a deadline
+//! \param event Reference to event
+//! \param deadline Deadline
+//! \return true if an event was got, false if the deadline passed first
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+bool
+event_queue::impl::wait_for_event_until (ALLEGRO_EVENT& event, std::chrono::steady_clock::time_point deadline)
+{
+  const std::chrono::duration <double> remaining = deadline - std::chrono::steady_clock::now ();
+
+  if (remaining.count () <= 0.0)
+    return al_get_next_event (obj_, &event);
+
+  ALLEGRO_TIMEOUT timeout;
+  al_init_timeout (&timeout, remaining.count ());
+
+  return al_wait_for_event_until (obj_, &event, &timeout);
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Copy the next event, leaving it in the queue
+//! \param event Reference to event
+//! \return true if an event was copied, false if the queue was empty
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+bool
+event_queue::impl::peek (ALLEGRO_EVENT& event) const
+{
+  return al_peek_next_event (obj_, &event);
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Get pending events, without waiting
+//! \param events Event array
+//! \param max_count Array size
+//! \return Number of events got
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+std::size_t
+event_queue::impl::drain (ALLEGRO_EVENT *events, std::size_t max_count)
+{
+  if (!events && max_count)
+    throw std::invalid_argument ("null event array");
+
+  std::size_t count = 0;
+
+  while (count < max_count && al_get_next_event (obj_, events + count))
+    count++;
+
+  return count;
+}
+
 // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
 //! \brief Constructor
 // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
@@ -182,4 +249,54 @@ event_queue::get_event (ALLEGRO_EVENT& event)
   impl_->get_event (event);
 }
 
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Get event, if there is one pending. Never blocks
+//! \param event Reference to event
+//! \return true if an event was got, false if the queue was empty
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+bool
+event_queue::try_get_event (ALLEGRO_EVENT& event)
+{
+  return impl_->try_get_event (event);
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Wait for event until a deadline
+//! \param event Reference to event
+//! \param deadline Deadline. A past deadline makes it a try_get_event
+//! \return true if an event was got, false if the deadline passed first
+//!
+//! A render loop waits until its next frame is due, so it wakes up for input
+//! without stalling when no event arrives.
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+bool
+event_queue::wait_for_event_until (ALLEGRO_EVENT& event, std::chrono::steady_clock::time_point deadline)
+{
+  return impl_->wait_for_event_until (event, deadline);
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Copy the next event, leaving it in the queue. Never blocks
+//! \param event Reference to event
+//! \return true if an event was copied, false if the queue was empty
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+bool
+event_queue::peek (ALLEGRO_EVENT& event) const
+{
+  return impl_->peek (event);
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Get all pending events, up to max_count, in one call. Never blocks
+//! \param events Event array
+//! \param max_count Array size
+//! \return Number of events got. Less than max_count means the queue is empty
+//! \throws std::invalid_argument If events is null and max_count is not 0
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+std::size_t
+event_queue::drain (ALLEGRO_EVENT *events, std::size_t max_count)
+{
+  return impl_->drain (events, max_count);
+}
+
 } // namespace allegropp
@@ -0,0 +1,119 @@
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @author      Eduardo Aguiar <aguiar@protonmail.ch>
+// @copyright   Copyright (c) 2025 Eduardo Aguiar
+//
+// This file is part of Allegro++.
+// 
+// Allegro++ is free software: you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+// 
+// You should have received a copy of the GNU Lesser General Public License
+// along with Allegro++. If not, see <https://www.gnu.org/licenses/>.
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+#include "file_mapping.hpp"
+#include <stdexcept>
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace allegropp
+{
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @brief Maps a whole file, copy-on-write.
+// @param path File path.
+// @throws std::runtime_error If the file cannot be opened or mapped.
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+file_mapping::file_mapping (const std::string& path)
+{
+#ifdef _WIN32
+    HANDLE file = CreateFileA (path.c_str (), GENERIC_READ, FILE_SHARE_READ | FILE_SHARE_DELETE, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+
+    if (file == INVALID_HANDLE_VALUE)
+      throw std::runtime_error ("unable to open file: " + path);
+
+    LARGE_INTEGER size;
+
+    if (!GetFileSizeEx (file, &size))
+      {
+        CloseHandle (file);
+        throw std::runtime_error ("unable to open file: " + path);
+      }
+
+    size_ = std::size_t (size.QuadPart);
+
+    if (size_)
+      {
+        HANDLE mapping = CreateFileMappingA (file, nullptr, PAGE_WRITECOPY, 0, 0, nullptr);
+
+        if (mapping)
+          {
+            data_ = static_cast <char *> (MapViewOfFile (mapping, FILE_MAP_COPY, 0, 0, 0));
+            CloseHandle (mapping);
+          }
+      }
+
+    CloseHandle (file);
+
+    if (size_ && !data_)
+      throw std::runtime_error ("unable to map file: " + path);
+
+#else
+    int fd = open (path.c_str (), O_RDONLY);
+
+    if (fd < 0)
+      throw std::runtime_error ("unable to open file: " + path);
+
+    struct stat st;
+
+    if (fstat (fd, &st) != 0)
+      {
+        close (fd);
+        throw std::runtime_error ("unable to open file: " + path);
+      }
+
+    size_ = std::size_t (st.st_size);
+
+    if (size_)
+      {
+        void *data = mmap (nullptr, size_, PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, 0);
+
+        if (data != MAP_FAILED)
+          data_ = static_cast <char *> (data);
+      }
+
+    close (fd);
+
+    if (size_ && !data_)
+      throw std::runtime_error ("unable to map file: " + path);
+#endif
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @brief Unmaps the file, discarding changes made to the mapping.
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+file_mapping::~file_mapping ()
+{
+    if (!data_)
+      return;
+
+#ifdef _WIN32
+    UnmapViewOfFile (data_);
+#else
+    munmap (data_, size_);
+#endif
+}
+
+} // namespace allegropp
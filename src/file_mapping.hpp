@@ -0,0 +1,62 @@
+#ifndef ALLEGROPP_FILE_MAPPING
+#define ALLEGROPP_FILE_MAPPING
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @author      Eduardo Aguiar <aguiar@protonmail.ch>
+// @copyright   Copyright (c) 2025 Eduardo Aguiar
+//
+// This file is part of Allegro++.
+// 
+// Allegro++ is free software: you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+// 
+// You should have received a copy of the GNU Lesser General Public License
+// along with Allegro++. If not, see <https://www.gnu.org/licenses/>.
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+#include <cstddef>
+#include <string>
+
+namespace allegropp
+{
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @class file_mapping
+// @brief Private, copy-on-write memory mapping of a whole file.
+//
+// Pages are read on first access, and writes to the mapping stay in memory
+// instead of reaching the file.
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+class file_mapping
+{
+public:
+    explicit file_mapping (const std::string& path);
+    file_mapping (const file_mapping&) = delete;
+    file_mapping& operator= (const file_mapping&) = delete;
+    ~file_mapping ();
+
+    char *
+    get_data () const
+    {
+        return data_;
+    }
+
+    std::size_t
+    get_size () const
+    {
+        return size_;
+    }
+
+private:
+    char *data_ = nullptr;              ///< Mapped file contents
+    std::size_t size_ = 0;              ///< File size
+};
+
+} // namespace allegropp
+
+#endif
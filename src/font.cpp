@@ -19,6 +19,8 @@
 // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
 #include <allegropp/allegropp.hpp>
 #include <allegropp/font.hpp>
+#include "baked_font.hpp"
+#include "utf8.hpp"
 #include <allegro5/allegro.h>
 #include <allegro5/allegro_font.h>
 #include <allegro5/allegro_ttf.h>
@@ -35,9 +37,24 @@ static const std::string SYSTEM_DEFAULT_FONT_DIR = "/usr/share/fonts/truetype";
 static void
 _init ()
 {
-  allegropp::init ();       // Initialize Allegro main system
+  allegropp::init_image (); // Initialize image subsystem, for baked font sheets
   al_init_font_addon ();    // Initialize font subsystem
   al_init_ttf_addon ();     // Initialize font TTF subsystem
+  al_register_font_loader (allegropp::BAKED_FONT_EXTENSION, allegropp::load_baked_font);
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Check if path is a baked font metrics file
+//! \param path Path
+//! \return true/false
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+static bool
+_is_baked_font (const std::string& path)
+{
+  const std::string_view extension = allegropp::BAKED_FONT_EXTENSION;
+
+  return path.size () >= extension.size () &&
+         path.compare (path.size () - extension.size (), extension.size (), extension) == 0;
 }
 
 } // namespace
@@ -58,7 +75,7 @@ public:
   impl () = default;
   impl (const impl&) = delete;
   impl (impl&&) = delete;
-  impl (const std::string&, std::size_t);
+  impl (const std::string&, std::size_t, int);
   ~impl ();
 
   // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
@@ -81,31 +98,55 @@ public:
   int get_font_line_height () const;
   int get_font_ascent () const;
   int get_font_descent () const;
-  int get_text_width (const std::string&) const;
-  void draw_text (const std::string&, const color&, int, int, int);
+  int get_text_width (std::string_view) const;
+  void draw_text (std::string_view, const color&, int, int, int);
+  void prewarm_glyphs (std::string_view) const;
+
+  // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+  //! \brief Get implementation object
+  //! \return Allegro font
+  // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+  ALLEGRO_FONT *
+  get_implementation () const noexcept
+  {
+    return obj_;
+  }
 
 private:
   //! \brief Allegro font object
   ALLEGRO_FONT *obj_ = nullptr;
+
+  //! \brief Baked font metrics, as Allegro bitmap fonts have no ascent and descent
+  bool is_baked_ = false;
+  baked_font_face face_ = {};
 };
 
 // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
 //! \brief Constructor
 //! \param path Font path
 //! \param size Font size
+//! \param flags Font loading flags (ALLEGRO_TTF_NO_KERNING, etc)
+//!
+//! Baked fonts (see bake_font) are not searched in SYSTEM_DEFAULT_FONT_DIR.
 // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
-font::impl::impl (const std::string& path, std::size_t size)
+font::impl::impl (const std::string& path, std::size_t size, int flags)
 {
   std::call_once (is_initialized_, _init);
   
   // Try to load font using path
-  obj_ = al_load_font (path.c_str (), size, 0);
+  obj_ = al_load_font (path.c_str (), size, flags);
+
+  if (_is_baked_font (path))
+    {
+      is_baked_ = obj_ && get_baked_font_face (path, int (size), face_);
+      return;
+    }
   
   // If it fails and path has no dirname, search for file in the SYSTEM_DEFAULT_FONT_DIR
   if (!obj_ && path.find ('/') == std::string::npos)
     {
       const std::string new_path = SYSTEM_DEFAULT_FONT_DIR + '/' + path;
-      obj_ = al_load_font (new_path.c_str (), size, 0);      
+      obj_ = al_load_font (new_path.c_str (), size, flags);      
     }
 }
 
@@ -140,6 +181,9 @@ font::impl::get_font_ascent () const
 {
   if (!obj_)
     throw std::invalid_argument ("null font object");
+
+  if (is_baked_)
+    return face_.ascent;
     
   return al_get_font_ascent (obj_);
 }
@@ -153,39 +197,70 @@ font::impl::get_font_descent () const
 {
   if (!obj_)
     throw std::invalid_argument ("null font object");
+
+  if (is_baked_)
+    return face_.descent;
     
   return al_get_font_descent (obj_);
 }
 
 // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
 //! \brief Get text width
-//! \param text Text
+//! \param text UTF-8 text
 //! \return Text width in pixels
+//!
+//! The text is referenced in place through an ALLEGRO_USTR_INFO, so it
+//! needs no NUL terminator and is not copied.
 // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
 int
-font::impl::get_text_width (const std::string& text) const
+font::impl::get_text_width (std::string_view text) const
 {
   if (!obj_)
     throw std::invalid_argument ("null font object");
-    
-  return al_get_text_width (obj_, text.c_str ());
+
+  ALLEGRO_USTR_INFO info;
+  const ALLEGRO_USTR *ustr = al_ref_buffer (&info, text.data (), text.size ());
+
+  return al_get_ustr_width (obj_, ustr);
 }
 
 // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
 //! \brief Draw text at position
-//! \param text Text
+//! \param text UTF-8 text
 //! \param c Color object
 //! \param x X pos
 //! \param y Y pos
 //! \param align Text alignment (LEFT, CENTER, RIGHT)
 // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
 void
-font::impl::draw_text (const std::string& text, const color& c, int x, int y, int align)
+font::impl::draw_text (std::string_view text, const color& c, int x, int y, int align)
 {
   if (!obj_)
     throw std::invalid_argument ("null font object");
 
-  al_draw_text(obj_, c.get_implementation (), x, y, align, text.c_str());
+  ALLEGRO_USTR_INFO info;
+  const ALLEGRO_USTR *ustr = al_ref_buffer (&info, text.data (), text.size ());
+
+  al_draw_ustr (obj_, c.get_implementation (), x, y, align, ustr);
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Rasterize glyphs ahead of drawing
+//! \param charset UTF-8 characters
+//!
+//! Querying glyph dimensions makes the TTF addon render the glyph into its
+//! glyph cache, so text drawn later does not stall on FreeType.
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+void
+font::impl::prewarm_glyphs (std::string_view charset) const
+{
+  if (!obj_)
+    throw std::invalid_argument ("null font object");
+
+  int bbx, bby, bbw, bbh;
+
+  for (std::size_t pos = 0; pos < charset.size ();)
+    al_get_glyph_dimensions (obj_, decode_utf8 (charset, pos), &bbx, &bby, &bbw, &bbh);
 }
 
 // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
@@ -200,9 +275,19 @@ font::font ()
 //! \brief Constructor
 //! \param path Font path
 //! \param size Font size
+//! \param flags Font loading flags (ALLEGRO_TTF_NO_KERNING, etc)
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+font::font (const std::string& path, std::size_t size, int flags)
+  : impl_ (std::make_shared <impl> (path, size, flags))
+{
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Constructor
+//! \param impl Implementation smart pointer
 // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
-font::font (const std::string& path, std::size_t size)
-  : impl_ (std::make_shared <impl> (path, size))
+font::font (const std::shared_ptr <impl>& impl)
+  : impl_ (impl)
 {
 }
 
@@ -247,24 +332,24 @@ font::get_font_descent () const
 
 // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
 //! \brief Get text width
-//! \param text Text
+//! \param text UTF-8 text
 //! \return Text width in pixels
 // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
 int
-font::get_text_width (const std::string& text) const
+font::get_text_width (std::string_view text) const
 {
-  return impl_->get_text_width (text.c_str ());
+  return impl_->get_text_width (text);
 }
 
 // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
 //! \brief Draw text at left position
 //! \param x X pos
 //! \param y Y pos
-//! \param text Text
+//! \param text UTF-8 text
 //! \param c Color object
 // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
 void
-font::draw_text_left (int x, int y, const std::string& text, const color& c)
+font::draw_text_left (int x, int y, std::string_view text, const color& c)
 {
   impl_->draw_text (text, c, x, y, ALLEGRO_ALIGN_LEFT);
 }
@@ -273,11 +358,11 @@ font::draw_text_left (int x, int y, const std::string& text, const color& c)
 //! \brief Draw text at center position
 //! \param x X pos
 //! \param y Y pos
-//! \param text Text
+//! \param text UTF-8 text
 //! \param c Color object
 // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
 void
-font::draw_text_center (int x, int y, const std::string& text, const color& c)
+font::draw_text_center (int x, int y, std::string_view text, const color& c)
 {
   impl_->draw_text (text, c, x, y, ALLEGRO_ALIGN_CENTER);
 }
@@ -286,13 +371,35 @@ font::draw_text_center (int x, int y, const std::string& text, const color& c)
 //! \brief Draw text at left position
 //! \param x X pos
 //! \param y Y pos
-//! \param text Text
+//! \param text UTF-8 text
 //! \param c Color object
 // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
 void
-font::draw_text_right (int x, int y, const std::string& text, const color& c)
+font::draw_text_right (int x, int y, std::string_view text, const color& c)
 {
   impl_->draw_text (text, c, x, y, ALLEGRO_ALIGN_RIGHT);
 }
 
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Rasterize glyphs ahead of drawing, avoiding hitches on first use
+//! \param charset UTF-8 characters
+//!
+//! Call with the display current, so the glyph cache pages are video bitmaps.
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+void
+font::prewarm_glyphs (std::string_view charset) const
+{
+  impl_->prewarm_glyphs (charset);
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Get implementation object
+//! \return Allegro font
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+ALLEGRO_FONT *
+font::get_implementation () const
+{
+  return impl_->get_implementation ();
+}
+
 } // namespace allegropp
@@ -0,0 +1,271 @@
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @author      Eduardo Aguiar <aguiar@protonmail.ch>
+// @copyright   Copyright (c) 2025 Eduardo Aguiar
+//
+// This file is part of Allegro++.
+// 
+// Allegro++ is free software: you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+// 
+// You should have received a copy of the GNU Lesser General Public License
+// along with Allegro++. If not, see <https://www.gnu.org/licenses/>.
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+#include <allegropp/gradient.hpp>
+#include <allegropp/bitmap_lock.hpp>
+#include <allegropp/color_batch.hpp>
+#include <cmath>
+#include <stdexcept>
+
+namespace
+{
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Convert sRGB component to linear light
+//! \param c sRGB component (0..1)
+//! \return Linear component (0..1)
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+float
+srgb_to_linear (float c)
+{
+  if (c <= 0.04045f)
+    return c / 12.92f;
+
+  return std::pow ((c + 0.055f) / 1.055f, 2.4f);
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Convert linear light component to sRGB
+//! \param c Linear component (0..1)
+//! \return sRGB component (0..1)
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+float
+linear_to_srgb (float c)
+{
+  if (c <= 0.0031308f)
+    return c * 12.92f;
+
+  return 1.055f * std::pow (c, 1.0f / 2.4f) - 0.055f;
+}
+
+} // namespace
+
+namespace allegropp
+{
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Constructor
+//! \param stops Color stops, in any order
+//! \param size Lookup table size (power of two, at least 2)
+//! \param interpolation Interpolation space
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+gradient::gradient (const std::vector <stop>& stops, std::size_t size, interpolation_type interpolation)
+  : mask_ (size - 1),
+    scale_ (float (size - 1)),
+    interpolation_ (interpolation)
+{
+  if (stops.empty ())
+    throw std::invalid_argument ("gradient needs at least one color stop");
+
+  if (size < 2 || (size & (size - 1)) != 0)
+    throw std::invalid_argument ("gradient size must be a power of two");
+
+  if (interpolation > LINEAR_RGB)
+    throw std::invalid_argument ("invalid gradient interpolation");
+
+  // Sort stops by position
+  std::vector <stop> sorted (stops);
+
+  for (auto& s : sorted)
+    s.position = std::min (std::max (s.position, 0.0f), 1.0f);
+
+  std::stable_sort (sorted.begin (), sorted.end (), [] (const stop& a, const stop& b) {
+    return a.position < b.position;
+  });
+
+  // Convert stops to the interpolation space: three components plus alpha
+  const std::size_t count = sorted.size ();
+  std::vector <ALLEGRO_COLOR> rgba (count);
+  std::vector <float> space (count * 4);
+
+  for (std::size_t i = 0; i < count; i++)
+    rgba[i] = sorted[i].value.get_implementation ();
+
+  if (interpolation == HSV)
+    {
+      std::vector <float> hsv (count * 3);
+      colors_to_hsv (rgba.data (), hsv.data (), count);
+
+      for (std::size_t i = 0; i < count; i++)
+        std::copy_n (&hsv[i * 3], 3, &space[i * 4]);
+    }
+
+  else
+    {
+      for (std::size_t i = 0; i < count; i++)
+        {
+          space[i * 4] = rgba[i].r;
+          space[i * 4 + 1] = rgba[i].g;
+          space[i * 4 + 2] = rgba[i].b;
+        }
+
+      if (interpolation == LINEAR_RGB)
+        for (std::size_t i = 0; i < count; i++)
+          for (std::size_t j = 0; j < 3; j++)
+            space[i * 4 + j] = srgb_to_linear (space[i * 4 + j]);
+    }
+
+  for (std::size_t i = 0; i < count; i++)
+    space[i * 4 + 3] = rgba[i].a;
+
+  // Interpolate table entries
+  std::vector <float> entries (size * 4);
+  std::size_t segment = 0;
+
+  for (std::size_t i = 0; i < size; i++)
+    {
+      const float t = float (i) / scale_;
+
+      while (segment + 1 < count && sorted[segment + 1].position < t)
+        segment++;
+
+      const float *a = &space[segment * 4];
+      const float *b = &space[std::min (segment + 1, count - 1) * 4];
+      const float p0 = sorted[segment].position;
+      const float p1 = sorted[std::min (segment + 1, count - 1)].position;
+
+      float f = 0.0f;
+
+      if (t >= p1)
+        f = 1.0f;
+
+      else if (t > p0)
+        f = (t - p0) / (p1 - p0);
+
+      float *e = &entries[i * 4];
+
+      for (std::size_t j = 0; j < 4; j++)
+        e[j] = a[j] + (b[j] - a[j]) * f;
+
+      // HSV: take the shortest way around the hue circle, and keep the hue
+      // of the saturated end when the other one is gray
+      if (interpolation == HSV)
+        {
+          float h0 = a[0];
+          float h1 = b[0];
+
+          if (a[1] == 0.0f)
+            h0 = h1;
+
+          else if (b[1] == 0.0f)
+            h1 = h0;
+
+          float d = h1 - h0;
+
+          if (d > 180.0f)
+            d -= 360.0f;
+
+          else if (d < -180.0f)
+            d += 360.0f;
+
+          e[0] = h0 + d * f;
+        }
+    }
+
+  // Convert entries back to RGBA
+  lut_.resize (size);
+
+  if (interpolation == HSV)
+    {
+      std::vector <float> hsv (size * 3);
+
+      for (std::size_t i = 0; i < size; i++)
+        std::copy_n (&entries[i * 4], 3, &hsv[i * 3]);
+
+      colors_from_hsv (hsv.data (), lut_.data (), size);
+
+      for (std::size_t i = 0; i < size; i++)
+        lut_[i].a = entries[i * 4 + 3];
+    }
+
+  else
+    {
+      for (std::size_t i = 0; i < size; i++)
+        {
+          float *e = &entries[i * 4];
+
+          if (interpolation == LINEAR_RGB)
+            for (std::size_t j = 0; j < 3; j++)
+              e[j] = linear_to_srgb (e[j]);
+
+          lut_[i] = ALLEGRO_COLOR {e[0], e[1], e[2], e[3]};
+        }
+    }
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Get lookup table size
+//! \return Number of entries
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+std::size_t
+gradient::get_size () const noexcept
+{
+  return lut_.size ();
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Get lookup table
+//! \return Pointer to get_size () Allegro colors
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+const ALLEGRO_COLOR *
+gradient::get_data () const noexcept
+{
+  return lut_.data ();
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Get interpolation space
+//! \return Interpolation type
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+gradient::interpolation_type
+gradient::get_interpolation () const noexcept
+{
+  return interpolation_;
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Export lookup table as a get_size () x 1 bitmap
+//! \return New bitmap, using the current new bitmap flags
+//!
+//! Drawing the bitmap scaled (or sampling it from a texture lookup) maps a
+//! position along its width to the gradient color, without any shader.
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+bitmap
+gradient::get_bitmap () const
+{
+  bitmap b (lut_.size (), 1);
+
+  if (!b.get_implementation ())
+    throw std::runtime_error ("cannot create gradient bitmap");
+
+  auto lock = b.lock (ALLEGRO_PIXEL_FORMAT_ABGR_8888_LE, bitmap::WRITE_ONLY);
+  auto *p = reinterpret_cast <std::uint8_t *> (lock.get_span <std::uint32_t> ()[0]);
+
+  for (const auto& c : lut_)
+    {
+      *p++ = std::uint8_t (c.r * 255.0f + 0.5f);
+      *p++ = std::uint8_t (c.g * 255.0f + 0.5f);
+      *p++ = std::uint8_t (c.b * 255.0f + 0.5f);
+      *p++ = std::uint8_t (c.a * 255.0f + 0.5f);
+    }
+
+  lock.unlock ();
+
+  return b;
+}
+
+} // namespace allegropp
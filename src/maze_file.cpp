@@ -0,0 +1,208 @@
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @author      Eduardo Aguiar <aguiar@protonmail.ch>
+// @copyright   Copyright (c) 2025 Eduardo Aguiar
+//
+// This file is part of Allegro++.
+// 
+// Allegro++ is free software: you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+// 
+// You should have received a copy of the GNU Lesser General Public License
+// along with Allegro++. If not, see <https://www.gnu.org/licenses/>.
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+#include "maze_file.hpp"
+#include "file_mapping.hpp"
+#include "maze_impl.hpp"
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <stdexcept>
+#include <type_traits>
+#include <variant>
+
+namespace allegropp
+{
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @brief Loads a maze file.
+// @param path File path.
+// @return Implementation using the file contents.
+// @throws std::runtime_error If the file cannot be read or is not valid.
+//
+// Byte and bit grids use the mapped file directly. RLE rows are decoded.
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+std::shared_ptr <maze::impl>
+maze::impl::load (const std::string& path)
+{
+    auto file = std::make_shared <file_mapping> (path);
+    const std::runtime_error invalid ("invalid maze file: " + path);
+
+    maze_file_header header;
+
+    if (file->get_size () < sizeof (header))
+      throw invalid;
+
+    std::memcpy (&header, file->get_data (), sizeof (header));
+
+    if (std::memcmp (header.magic, maze_file_header::MAGIC, sizeof (header.magic)) != 0 ||
+        header.byte_order != maze_file_header::ORDER_MARK ||
+        header.version != maze_file_header::VERSION ||
+        header.storage > RLE_STORAGE ||
+        header.generator > SIDEWINDER ||
+        header.width % 2 == 0 || header.width > 0x7fffffff ||
+        header.height % 2 == 0 || header.height > 0x7fffffff)
+      throw invalid;
+
+    const int w = int (header.width);
+    const int h = int (header.height);
+    char *data = file->get_data () + sizeof (header);
+    const std::uint64_t size = file->get_size () - sizeof (header);
+
+    switch (header.storage)
+      {
+        case BYTE_STORAGE:
+          if (size != std::uint64_t (w) * h)
+            throw invalid;
+
+          return std::make_shared <impl> (header, maze_byte_grid (w, data, file));
+
+        case BIT_STORAGE:
+          if (size != std::uint64_t (maze_bit_grid::get_words_per_row (w)) * h * 8)
+            throw invalid;
+
+          return std::make_shared <impl> (header, maze_bit_grid (w, data, file));
+
+        default:
+          {
+            std::vector <std::vector <maze_rle_grid::run>> rows (h);
+            const char *p = data;
+            const char *end = data + size;
+
+            auto read = [&]()
+            {
+                std::uint32_t value;
+
+                if (end - p < 4)
+                  throw invalid;
+
+                std::memcpy (&value, p, 4);
+                p += 4;
+                return value;
+            };
+
+            for (auto& runs : rows)
+              {
+                std::uint32_t count = read ();
+
+                if (count > std::uint32_t (w))
+                  throw invalid;
+
+                runs.reserve (count);
+
+                for (std::uint32_t i = 0; i < count; i++)
+                  {
+                    std::uint32_t begin = read ();
+                    std::uint32_t run_end = read ();
+                    std::uint32_t type = read ();
+                    int prev_end = runs.empty () ? 0 : runs.back ().end;
+
+                    // Runs must be sorted, non-empty, walls and merged
+                    if (begin < std::uint32_t (prev_end) || begin >= run_end || run_end > std::uint32_t (w) ||
+                        type == PASSAGE || type > 255 ||
+                        (!runs.empty () && int (begin) == prev_end && runs.back ().type == type))
+                      throw invalid;
+
+                    runs.push_back ({int (begin), int (run_end), wall_type (type)});
+                  }
+              }
+
+            if (p != end)
+              throw invalid;
+
+            return std::make_shared <impl> (header, maze_rle_grid (std::move (rows)));
+          }
+      }
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @brief Saves the maze to a file.
+// @param path File path.
+// @throws std::runtime_error If the file cannot be written.
+//
+// The file is written next to its destination and renamed over it, so
+// mazes still mapping the previous file are not affected.
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+void
+maze::impl::save (const std::string& path) const
+{
+    maze_file_header header = {};
+    std::memcpy (header.magic, maze_file_header::MAGIC, sizeof (header.magic));
+    header.byte_order = maze_file_header::ORDER_MARK;
+    header.version = maze_file_header::VERSION;
+    header.storage = storage;
+    header.generator = generator;
+    header.width = width;
+    header.height = height;
+    header.seed = seed;
+
+    const std::string tmp_path = path + ".tmp";
+    std::ofstream out (tmp_path, std::ios::binary);
+    out.write (reinterpret_cast <const char *> (&header), sizeof (header));
+
+    std::visit ([&](const auto& grid)
+    {
+        using grid_t = std::decay_t <decltype (grid)>;
+
+        if constexpr (std::is_same_v <grid_t, maze_byte_grid>)
+          out.write (static_cast <const char *> (grid.get_data ()), std::streamsize (width) * height);
+
+        else if constexpr (std::is_same_v <grid_t, maze_bit_grid>)
+          out.write (static_cast <const char *> (grid.get_data ()), std::streamsize (maze_bit_grid::get_words_per_row (width)) * height * 8);
+
+        else
+          {
+            auto write = [&](std::uint32_t value)
+            {
+                out.write (reinterpret_cast <const char *> (&value), 4);
+            };
+
+            for (const auto& runs : grid.get_rows ())
+              {
+                write (std::uint32_t (runs.size ()));
+
+                for (const auto& r : runs)
+                  {
+                    write (r.begin);
+                    write (r.end);
+                    write (r.type);
+                  }
+              }
+          }
+    }, walls);
+
+    out.close ();
+
+    if (!out)
+      {
+        std::remove (tmp_path.c_str ());
+        throw std::runtime_error ("unable to write maze file: " + path);
+      }
+
+#ifdef _WIN32
+    std::remove (path.c_str ());
+#endif
+
+    if (std::rename (tmp_path.c_str (), path.c_str ()) != 0)
+      {
+        std::remove (tmp_path.c_str ());
+        throw std::runtime_error ("unable to write maze file: " + path);
+      }
+}
+
+} // namespace allegropp
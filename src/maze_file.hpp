@@ -0,0 +1,60 @@
+#ifndef ALLEGROPP_MAZE_FILE
+#define ALLEGROPP_MAZE_FILE
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @author      Eduardo Aguiar <aguiar@protonmail.ch>
+// @copyright   Copyright (c) 2025 Eduardo Aguiar
+//
+// This file is part of Allegro++.
+// 
+// Allegro++ is free software: you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+// 
+// You should have received a copy of the GNU Lesser General Public License
+// along with Allegro++. If not, see <https://www.gnu.org/licenses/>.
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+#include <cstdint>
+
+namespace allegropp
+{
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @struct maze_file_header
+// @brief Header of a maze file, followed by the cell data.
+//
+// Cell data depends on the storage type:
+//   BYTE_STORAGE: width * height bytes, row-major.
+//   BIT_STORAGE:  (width + 63) / 64 64-bit words per row, 1 = WALL.
+//   RLE_STORAGE:  per row, a 32-bit run count followed by the runs, as
+//                 32-bit begin, end and wall type.
+// Numbers are in host byte order, checked through ORDER_MARK, so byte and
+// bit data can be mapped as is. The header size keeps the data 8-byte aligned.
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+struct maze_file_header
+{
+    static constexpr char MAGIC[8] = {'A', 'L', 'P', 'P', 'M', 'A', 'Z', 'E'};
+    static constexpr std::uint32_t ORDER_MARK = 0x01020304;
+    static constexpr std::uint16_t VERSION = 1;
+
+    char magic[8];                      ///< MAGIC
+    std::uint32_t byte_order;           ///< ORDER_MARK, as written by the host
+    std::uint16_t version;              ///< File format version
+    std::uint8_t storage;               ///< maze::storage_type
+    std::uint8_t generator;             ///< maze::generator_type
+    std::uint32_t width;                ///< Grid width
+    std::uint32_t height;               ///< Grid height
+    std::uint32_t seed;                 ///< Generation seed
+    std::uint32_t reserved;             ///< Zero
+};
+
+static_assert (sizeof (maze_file_header) == 32, "maze_file_header must be 32 bytes");
+
+} // namespace allegropp
+
+#endif
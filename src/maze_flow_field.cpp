@@ -0,0 +1,333 @@
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @author      Eduardo Aguiar <aguiar@protonmail.ch>
+// @copyright   Copyright (c) 2025 Eduardo Aguiar
+//
+// This file is part of Allegro++.
+// 
+// Allegro++ is free software: you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+// 
+// You should have received a copy of the GNU Lesser General Public License
+// along with Allegro++. If not, see <https://www.gnu.org/licenses/>.
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+#include <allegropp/maze_flow_field.hpp>
+#include "maze_impl.hpp"
+#include <algorithm>
+#include <climits>
+#include <cstdint>
+#include <functional>
+#include <variant>
+
+namespace allegropp
+{
+namespace
+{
+constexpr int INFINITE = INT_MAX;
+constexpr int DIR_X[4] = {0, 1, 0, -1};
+constexpr int DIR_Y[4] = {-1, 0, 1, 0};
+} // namespace
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @struct maze_flow_field::impl
+// @brief Private implementation details of the maze_flow_field class (PIMPL).
+//
+// Distances are kept as INFINITE for cells that are walls or cannot reach
+// a goal. A non-goal cell is consistent when its distance is one more than
+// its closest open neighbour, and every update restores that invariant.
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+struct maze_flow_field::impl
+{
+    using entry = std::pair <int, std::uint32_t>;
+
+    std::shared_ptr <maze::impl> maze_;     ///< Maze covered by the field
+    std::vector <int> dist;                 ///< Distance per cell
+    std::vector <std::uint32_t> goals;      ///< Goal cell indexes (sorted)
+    std::vector <std::uint32_t> queue;      ///< Work queue
+    std::vector <std::uint32_t> invalid;    ///< Cells invalidated by a closing
+    std::vector <entry> heap;               ///< Repair queue (min-heap)
+    std::uint64_t revision = 0;             ///< Maze revision the field reflects
+
+    explicit impl (const std::shared_ptr <maze::impl>& m)
+      : maze_ (m),
+        dist (std::size_t (m->width) * m->height, INFINITE),
+        revision (m->revision)
+    {
+    }
+
+    template <typename Grid>
+    bool
+    is_open (const Grid& grid, int x, int y) const
+    {
+        return maze_->in_bounds (x, y) && grid.get (x, y) == maze::PASSAGE;
+    }
+
+    bool
+    is_goal (std::uint32_t i) const
+    {
+        return std::binary_search (goals.begin (), goals.end (), i);
+    }
+
+    // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+    // @brief Calls f (neighbour index) for each open 4-neighbour of cell i.
+    // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+    template <typename Grid, typename F>
+    void
+    for_each_neighbour (const Grid& grid, std::uint32_t i, F f) const
+    {
+        const int x = i % maze_->width;
+        const int y = i / maze_->width;
+
+        for (int d = 0; d < 4; d++)
+          if (is_open (grid, x + DIR_X[d], y + DIR_Y[d]))
+            f (std::uint32_t (y + DIR_Y[d]) * maze_->width + x + DIR_X[d]);
+    }
+
+    // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+    // @brief Recomputes the whole field with a multi-source BFS.
+    // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+    template <typename Grid>
+    void
+    rebuild (const Grid& grid)
+    {
+        std::fill (dist.begin (), dist.end (), INFINITE);
+        queue.clear ();
+
+        for (std::uint32_t g : goals)
+          if (is_open (grid, g % maze_->width, g / maze_->width))
+            {
+              dist[g] = 0;
+              queue.push_back (g);
+            }
+
+        for (std::size_t head = 0; head < queue.size (); head++)
+          {
+            const std::uint32_t i = queue[head];
+
+            for_each_neighbour (grid, i, [&](std::uint32_t n)
+            {
+                if (dist[n] == INFINITE)
+                  {
+                    dist[n] = dist[i] + 1;
+                    queue.push_back (n);
+                  }
+            });
+          }
+    }
+
+    // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+    // @brief Lowers a cell's distance to the best one offered by its
+    //        neighbours, queueing it for propagation if it improved.
+    // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+    template <typename Grid>
+    void
+    relax (const Grid& grid, std::uint32_t i)
+    {
+        int best = is_goal (i) ? 0 : INFINITE;
+
+        for_each_neighbour (grid, i, [&](std::uint32_t n)
+        {
+            if (dist[n] != INFINITE)
+              best = std::min (best, dist[n] + 1);
+        });
+
+        if (best < dist[i])
+          {
+            dist[i] = best;
+            heap.emplace_back (best, i);
+            std::push_heap (heap.begin (), heap.end (), std::greater <entry> ());
+          }
+    }
+
+    // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+    // @brief Propagates queued distance decreases (Dijkstra order).
+    // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+    template <typename Grid>
+    void
+    propagate (const Grid& grid)
+    {
+        while (!heap.empty ())
+          {
+            std::pop_heap (heap.begin (), heap.end (), std::greater <entry> ());
+            const auto [d, i] = heap.back ();
+            heap.pop_back ();
+
+            if (d != dist[i])
+              continue;
+
+            for_each_neighbour (grid, i, [&](std::uint32_t n)
+            {
+                if (d + 1 < dist[n])
+                  {
+                    dist[n] = d + 1;
+                    heap.emplace_back (d + 1, n);
+                    std::push_heap (heap.begin (), heap.end (), std::greater <entry> ());
+                  }
+            });
+          }
+    }
+
+    // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+    // @brief Applies a change of cell c.
+    //
+    // An opened cell takes its distance from its neighbours and the decrease
+    // is propagated. A closed cell invalidates every cell whose distance it
+    // supported, transitively; those cells are then re-seeded from their
+    // valid neighbours and repaired the same way.
+    // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+    template <typename Grid>
+    void
+    apply_change (const Grid& grid, std::uint32_t c)
+    {
+        if (is_open (grid, c % maze_->width, c / maze_->width))
+          relax (grid, c);
+
+        else if (dist[c] != INFINITE)
+          {
+            invalid.clear ();
+            queue.clear ();
+
+            dist[c] = INFINITE;
+            for_each_neighbour (grid, c, [&](std::uint32_t n) { queue.push_back (n); });
+
+            while (!queue.empty ())
+              {
+                const std::uint32_t v = queue.back ();
+                queue.pop_back ();
+
+                if (dist[v] == INFINITE || is_goal (v))
+                  continue;
+
+                bool supported = false;
+                for_each_neighbour (grid, v, [&](std::uint32_t n)
+                {
+                    supported = supported || dist[n] == dist[v] - 1;
+                });
+
+                if (!supported)
+                  {
+                    const int d = dist[v];
+                    dist[v] = INFINITE;
+                    invalid.push_back (v);
+
+                    for_each_neighbour (grid, v, [&](std::uint32_t n)
+                    {
+                        if (dist[n] == d + 1)
+                          queue.push_back (n);
+                    });
+                  }
+              }
+
+            for (std::uint32_t v : invalid)
+              relax (grid, v);
+          }
+
+        propagate (grid);
+    }
+};
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @brief Constructs an empty flow field (no goals) for a maze.
+// @param m Maze covered by the field.
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+maze_flow_field::maze_flow_field (const maze& m)
+    : impl_ (std::make_shared<impl> (m.impl_))
+{
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @brief Sets the goal cells and recomputes the whole field.
+// @param goals Goal positions. Out-of-bounds positions are ignored.
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+void
+maze_flow_field::set_goals (const std::vector <point_type>& goals)
+{
+    impl_->goals.clear ();
+
+    for (const auto& [x, y] : goals)
+      if (impl_->maze_->in_bounds (x, y))
+        impl_->goals.push_back (std::uint32_t (y) * impl_->maze_->width + x);
+
+    std::sort (impl_->goals.begin (), impl_->goals.end ());
+
+    std::visit ([&](const auto& grid) { impl_->rebuild (grid); }, impl_->maze_->walls);
+    impl_->revision = impl_->maze_->revision;
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @brief Applies the cells changed by maze::set since the last update.
+//
+// @details Each change only touches the region of the field that depends on
+// the changed cell. If the maze changed more than the journal holds since the
+// last call, the field is rebuilt instead.
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+void
+maze_flow_field::update ()
+{
+    const auto& m = *impl_->maze_;
+
+    std::visit ([&](const auto& grid) {
+        if (m.revision - impl_->revision > maze::impl::JOURNAL_SIZE)
+          impl_->rebuild (grid);
+
+        else
+          for (auto r = impl_->revision; r != m.revision; r++)
+            impl_->apply_change (grid, m.journal[r % maze::impl::JOURNAL_SIZE]);
+    }, m.walls);
+
+    impl_->revision = m.revision;
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @brief Gets the distance from a cell to the nearest goal.
+// @param x X-coordinate (column) of the cell.
+// @param y Y-coordinate (row) of the cell.
+// @return Number of steps, or UNREACHABLE.
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+int
+maze_flow_field::get_distance (int x, int y) const
+{
+    if (!impl_->maze_->in_bounds (x, y))
+      return UNREACHABLE;
+
+    int d = impl_->dist[std::size_t (y) * impl_->maze_->width + x];
+    return d == INFINITE ? UNREACHABLE : d;
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @brief Gets the step an agent at a cell should take towards the nearest goal.
+// @param x X-coordinate (column) of the cell.
+// @param y Y-coordinate (row) of the cell.
+// @return Offset (dx, dy) to the next cell; (0, 0) at a goal or if unreachable.
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+maze_flow_field::point_type
+maze_flow_field::get_direction (int x, int y) const
+{
+    int best = get_distance (x, y);
+
+    if (best == UNREACHABLE)
+      return {0, 0};
+
+    point_type step {0, 0};
+
+    for (int d = 0; d < 4; d++)
+      {
+        int n = get_distance (x + DIR_X[d], y + DIR_Y[d]);
+
+        if (n != UNREACHABLE && n < best)
+          {
+            best = n;
+            step = {DIR_X[d], DIR_Y[d]};
+          }
+      }
+
+    return step;
+}
+
+} // namespace allegropp
@@ -0,0 +1,689 @@
+#ifndef ALLEGROPP_MAZE_GENERATOR
+#define ALLEGROPP_MAZE_GENERATOR
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @author      Eduardo Aguiar <aguiar@protonmail.ch>
+// @copyright   Copyright (c) 2025 Eduardo Aguiar
+//
+// This file is part of Allegro++.
+// 
+// Allegro++ is free software: you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+// 
+// You should have received a copy of the GNU Lesser General Public License
+// along with Allegro++. If not, see <https://www.gnu.org/licenses/>.
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+#include <allegropp/maze.hpp>
+#include <algorithm>
+#include <cstdint>
+#include <random>
+#include <utility>
+#include <vector>
+
+namespace allegropp
+{
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @class maze_eller_rows
+// @brief Eller's algorithm, one row of cells at a time.
+// @see https://www.astrolog.org/labyrnth/algrithm.htm
+//
+// Only the current row is kept: the set label of each cell, plus a
+// union-find over the labels of the row, so memory is O(width) whatever the
+// maze height. After each call to next, get_east and get_south tell which
+// cells of the row open to their east and south neighbours.
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+class maze_eller_rows
+{
+public:
+    // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+    // @brief Constructor.
+    // @param cells_w Number of cells per row.
+    // @param cells_h Number of cell rows.
+    // @param rng Random number generator, shared with the caller.
+    // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+    maze_eller_rows (int cells_w, int cells_h, std::mt19937& rng)
+      : cells_w_ (cells_w), cells_h_ (cells_h), rng_ (rng),
+        label_ (cells_w, -1), root_ (cells_w), east_ (cells_w), south_ (cells_w),
+        parent_ (2 * cells_w), count_ (2 * cells_w), pick_ (2 * cells_w), relabel_ (2 * cells_w)
+    {
+    }
+
+    // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+    // @brief Generates the next row of cells.
+    // @return False if all rows have been generated, true otherwise.
+    // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+    bool
+    next ()
+    {
+        if (row_ == cells_h_)
+          return false;
+
+        const bool last = ++row_ == cells_h_;
+
+        // Cells not joined from above start a set of their own. Labels
+        // carried from the previous row are below cells_w_.
+        int labels = cells_w_;
+
+        for (int& l : label_)
+          if (l < 0)
+            l = labels++;
+
+        for (int i = 0; i < labels; i++)
+          parent_[i] = i;
+
+        // Randomly join adjacent cells of different sets (all, on the last row)
+        for (int x = 0; x + 1 < cells_w_; x++)
+          {
+            int a = find (label_[x]);
+            int b = find (label_[x + 1]);
+
+            east_[x] = a != b && (last || coin ());
+
+            if (east_[x])
+              parent_[b] = a;
+          }
+
+        if (cells_w_ > 0)
+          east_[cells_w_ - 1] = 0;
+
+        for (int x = 0; x < cells_w_; x++)
+          root_[x] = find (label_[x]);
+
+        if (last)
+          {
+            std::fill (south_.begin (), south_.end (), 0);
+            return true;
+          }
+
+        // Randomly open cells downwards. count_ holds the set sizes, and
+        // pick_ is -1 for sets already going down.
+        for (int x = 0; x < cells_w_; x++)
+          {
+            count_[root_[x]] = 0;
+            pick_[root_[x]] = 0;
+          }
+
+        for (int x = 0; x < cells_w_; x++)
+          {
+            count_[root_[x]]++;
+            south_[x] = coin ();
+
+            if (south_[x])
+              pick_[root_[x]] = -1;
+          }
+
+        // Every set must go down at least once: open a random cell of each
+        // set that did not
+        for (int x = 0; x < cells_w_; x++)
+          {
+            int& pick = pick_[root_[x]];
+
+            if (pick >= 0 && count_[root_[x]] > 0)
+              {
+                std::uniform_int_distribution<int> dist (0, count_[root_[x]] - 1);
+                pick = dist (rng_) + 1;
+                count_[root_[x]] = 0;
+              }
+
+            if (pick > 0 && --pick == 0)
+              south_[x] = 1;
+          }
+
+        // Carry labels down, renumbered from 0
+        for (int x = 0; x < cells_w_; x++)
+          relabel_[root_[x]] = -1;
+
+        int carried = 0;
+
+        for (int x = 0; x < cells_w_; x++)
+          {
+            if (south_[x])
+              {
+                int& r = relabel_[root_[x]];
+
+                if (r < 0)
+                  r = carried++;
+
+                label_[x] = r;
+              }
+
+            else
+              label_[x] = -1;
+          }
+
+        return true;
+    }
+
+    const std::vector <std::uint8_t>&
+    get_east () const
+    {
+        return east_;
+    }
+
+    const std::vector <std::uint8_t>&
+    get_south () const
+    {
+        return south_;
+    }
+
+private:
+    int
+    find (int i)
+    {
+        while (parent_[i] != i)
+          i = parent_[i] = parent_[parent_[i]];
+
+        return i;
+    }
+
+    bool
+    coin ()
+    {
+        std::uniform_int_distribution<int> dist (0, 1);
+        return dist (rng_);
+    }
+
+    int cells_w_;                           ///< Cells per row
+    int cells_h_;                           ///< Number of cell rows
+    int row_ = 0;                           ///< Rows generated so far
+    std::mt19937& rng_;                     ///< Random number generator
+    std::vector <int> label_;               ///< Set label per cell, -1 if none
+    std::vector <int> root_;                ///< Set root per cell
+    std::vector <std::uint8_t> east_;       ///< Cell opens to the east
+    std::vector <std::uint8_t> south_;      ///< Cell opens to the south
+    std::vector <int> parent_;              ///< Union-find parent per label
+    std::vector <int> count_;               ///< Cells per set (by root)
+    std::vector <int> pick_;                ///< Countdown to forced south cell
+    std::vector <int> relabel_;             ///< Label in next row (by root)
+};
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @class maze_tile_view
+// @brief Rectangular window into a grid, with its own origin.
+//
+// Lets maze_generator carve a tile of a larger grid as if it were a whole
+// maze. The tile border lies on the wall lines shared with the neighbouring
+// tiles, which generators never carve.
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+template <typename Grid>
+class maze_tile_view
+{
+public:
+    maze_tile_view (Grid& grid, int x0, int y0)
+      : grid_ (grid), x0_ (x0), y0_ (y0)
+    {
+    }
+
+    maze::wall_type
+    get (int x, int y) const
+    {
+        return grid_.get (x0_ + x, y0_ + y);
+    }
+
+    void
+    set (int x, int y, maze::wall_type type)
+    {
+        grid_.set (x0_ + x, y0_ + y, type);
+    }
+
+private:
+    Grid& grid_;                            ///< Underlying grid
+    int x0_;                                ///< Tile origin X
+    int y0_;                                ///< Tile origin Y
+};
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @class maze_generator
+// @brief Perfect maze generation algorithms.
+// @see https://www.astrolog.org/labyrnth/algrithm.htm
+//
+// The grid starts filled with walls. Cells sit at odd coordinates, and two
+// neighbouring cells are connected by carving the wall between them.
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+template <typename Grid>
+class maze_generator
+{
+public:
+    // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+    // @brief Constructor.
+    // @param grid Grid to carve.
+    // @param width Grid width (odd).
+    // @param height Grid height (odd).
+    // @param rng Random number generator, already seeded.
+    // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+    maze_generator (Grid& grid, int width, int height, std::mt19937& rng)
+      : grid_ (grid), width_ (width), height_ (height),
+        cells_w_ ((width - 1) / 2), cells_h_ ((height - 1) / 2), rng_ (rng)
+    {
+    }
+
+    // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+    // @brief Runs a generation algorithm.
+    // @param type Algorithm.
+    // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+    void
+    run (maze::generator_type type)
+    {
+        if (cells_w_ <= 0 || cells_h_ <= 0)
+          return;
+
+        switch (type)
+          {
+            case maze::RECURSIVE_BACKTRACKER: recursive_backtracker (); break;
+            case maze::ELLER: eller (); break;
+            case maze::WILSON: wilson (); break;
+            case maze::KRUSKAL: kruskal (); break;
+            case maze::PRIM: prim (); break;
+            case maze::BINARY_TREE: binary_tree (); break;
+            case maze::SIDEWINDER: sidewinder (); break;
+          }
+    }
+
+    // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+    // @brief Recursive Backtracking, from a random starting cell.
+    //
+    // The recursion runs on an explicit stack of 16-bit frames, holding the
+    // shuffled directions (bits 0-7) and the next one to try (bits 8-10). The
+    // current cell is not stored: backtracking steps back along the direction
+    // the parent frame took. This bounds generation by heap rather than call
+    // stack and generates the same maze for a given seed as the recursive form.
+    // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+    void
+    recursive_backtracker ()
+    {
+        static constexpr int dir_x[4] = {0, 2, 0, -2};
+        static constexpr int dir_y[4] = {-2, 0, 2, 0};
+
+        std::uniform_int_distribution<int> dist_x (1, width_ - 2);
+        std::uniform_int_distribution<int> dist_y (1, height_ - 2);
+        int x = dist_x (rng_) | 1;  // Ensure odd
+        int y = dist_y (rng_) | 1;  // Ensure odd
+
+        std::vector <std::uint16_t> stack;
+        stack.push_back (enter_cell (x, y));
+
+        while (!stack.empty ())
+          {
+            std::uint16_t& frame = stack.back ();
+            int next = frame >> 8;
+
+            // Explore next direction
+            if (next < 4)
+              {
+                int d = (frame >> (next * 2)) & 3;
+                int new_x = x + dir_x[d];
+                int new_y = y + dir_y[d];
+                frame += 0x100;
+
+                if (in_bounds (new_x, new_y) && grid_.get (new_x, new_y) != maze::PASSAGE)
+                  {
+                    // Carve intermediate cell
+                    grid_.set (x + dir_x[d] / 2, y + dir_y[d] / 2, maze::PASSAGE);
+                    x = new_x;
+                    y = new_y;
+                    stack.push_back (enter_cell (x, y));
+                  }
+              }
+
+            // All directions explored: backtrack to parent cell
+            else
+              {
+                stack.pop_back ();
+
+                if (!stack.empty ())
+                  {
+                    std::uint16_t parent = stack.back ();
+                    int d = (parent >> (((parent >> 8) - 1) * 2)) & 3;
+                    x -= dir_x[d];
+                    y -= dir_y[d];
+                  }
+              }
+          }
+    }
+
+    // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+    // @brief Eller's algorithm, row by row (see maze_eller_rows).
+    // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+    void
+    eller ()
+    {
+        maze_eller_rows rows (cells_w_, cells_h_, rng_);
+
+        for (int cy = 0; rows.next (); cy++)
+          for (int cx = 0; cx < cells_w_; cx++)
+            {
+              carve (cx, cy);
+
+              if (rows.get_east ()[cx])
+                connect (cx, cy, 1, 0);
+
+              if (rows.get_south ()[cx])
+                connect (cx, cy, 0, 1);
+            }
+    }
+
+    // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+    // @brief Wilson's algorithm (loop-erased random walks).
+    //
+    // Generates an unbiased uniform spanning tree. Each walk records the last
+    // exit direction of the cells it crosses, so loops are erased implicitly
+    // when the walk is retraced.
+    // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+    void
+    wilson ()
+    {
+        static constexpr int dir_x[4] = {0, 1, 0, -1};
+        static constexpr int dir_y[4] = {-1, 0, 1, 0};
+
+        const std::uint32_t cells = std::uint32_t (cells_w_) * cells_h_;
+        std::vector <std::uint8_t> exit_dir (cells);
+        std::uniform_int_distribution<int> dist_dir (0, 3);
+
+        std::uniform_int_distribution<std::uint32_t> dist_cell (0, cells - 1);
+        std::uint32_t first = dist_cell (rng_);
+        carve (first % cells_w_, first / cells_w_);
+
+        for (std::uint32_t i = 0; i < cells; i++)
+          {
+            int cx = i % cells_w_;
+            int cy = i / cells_w_;
+
+            // Random walk until reaching the maze
+            while (!is_carved (cx, cy))
+              {
+                int d;
+
+                do
+                  d = dist_dir (rng_);
+                while (!is_cell (cx + dir_x[d], cy + dir_y[d]));
+
+                exit_dir[std::uint32_t (cy) * cells_w_ + cx] = d;
+                cx += dir_x[d];
+                cy += dir_y[d];
+              }
+
+            // Retrace the loop-erased walk, adding it to the maze
+            cx = i % cells_w_;
+            cy = i / cells_w_;
+
+            while (!is_carved (cx, cy))
+              {
+                int d = exit_dir[std::uint32_t (cy) * cells_w_ + cx];
+                carve (cx, cy);
+                connect (cx, cy, dir_x[d], dir_y[d]);
+                cx += dir_x[d];
+                cy += dir_y[d];
+              }
+          }
+    }
+
+    // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+    // @brief Randomized Kruskal's algorithm, with a union-find over cells.
+    // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+    void
+    kruskal ()
+    {
+        const std::uint32_t cells = std::uint32_t (cells_w_) * cells_h_;
+
+        // Edges: cell index * 2, plus 0 for east or 1 for south
+        std::vector <std::uint32_t> edges;
+        edges.reserve (2 * cells);
+
+        for (std::uint32_t i = 0; i < cells; i++)
+          {
+            carve (i % cells_w_, i / cells_w_);
+
+            if (int (i % cells_w_) + 1 < cells_w_)
+              edges.push_back (i * 2);
+
+            if (int (i / cells_w_) + 1 < cells_h_)
+              edges.push_back (i * 2 + 1);
+          }
+
+        shuffle (edges);
+
+        std::vector <std::uint32_t> parent (cells);
+
+        for (std::uint32_t i = 0; i < cells; i++)
+          parent[i] = i;
+
+        auto find = [&](std::uint32_t i)
+        {
+            while (parent[i] != i)
+              i = parent[i] = parent[parent[i]];
+
+            return i;
+        };
+
+        for (std::uint32_t e : edges)
+          {
+            std::uint32_t a = e / 2;
+            std::uint32_t b = (e & 1) ? a + cells_w_ : a + 1;
+            std::uint32_t ra = find (a);
+            std::uint32_t rb = find (b);
+
+            if (ra != rb)
+              {
+                parent[rb] = ra;
+                connect (a % cells_w_, a / cells_w_, (e & 1) ? 0 : 1, e & 1);
+              }
+          }
+    }
+
+    // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+    // @brief Randomized Prim's algorithm.
+    //
+    // Grows the maze from a random cell, each step joining a random frontier
+    // cell to a random neighbour already in the maze.
+    // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+    void
+    prim ()
+    {
+        static constexpr int dir_x[4] = {0, 1, 0, -1};
+        static constexpr int dir_y[4] = {-1, 0, 1, 0};
+
+        const std::uint32_t cells = std::uint32_t (cells_w_) * cells_h_;
+        std::vector <std::uint8_t> in_frontier (cells);
+        std::vector <std::uint32_t> frontier;
+
+        auto add = [&](int cx, int cy)
+        {
+            carve (cx, cy);
+
+            for (int d = 0; d < 4; d++)
+              {
+                int nx = cx + dir_x[d];
+                int ny = cy + dir_y[d];
+
+                if (is_cell (nx, ny) && !is_carved (nx, ny))
+                  {
+                    std::uint32_t n = std::uint32_t (ny) * cells_w_ + nx;
+
+                    if (!in_frontier[n])
+                      {
+                        in_frontier[n] = 1;
+                        frontier.push_back (n);
+                      }
+                  }
+              }
+        };
+
+        std::uniform_int_distribution<std::uint32_t> dist_cell (0, cells - 1);
+        std::uint32_t first = dist_cell (rng_);
+        add (first % cells_w_, first / cells_w_);
+
+        while (!frontier.empty ())
+          {
+            std::uniform_int_distribution<std::size_t> dist (0, frontier.size () - 1);
+            std::size_t k = dist (rng_);
+            std::uint32_t c = frontier[k];
+            frontier[k] = frontier.back ();
+            frontier.pop_back ();
+
+            int cx = c % cells_w_;
+            int cy = c / cells_w_;
+            int dirs[4];
+            int count = 0;
+
+            for (int d = 0; d < 4; d++)
+              if (is_cell (cx + dir_x[d], cy + dir_y[d]) && is_carved (cx + dir_x[d], cy + dir_y[d]))
+                dirs[count++] = d;
+
+            std::uniform_int_distribution<int> dist_dir (0, count - 1);
+            int d = dirs[dist_dir (rng_)];
+            connect (cx, cy, dir_x[d], dir_y[d]);
+            add (cx, cy);
+          }
+    }
+
+    // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+    // @brief Binary tree algorithm: every cell opens north or west.
+    // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+    void
+    binary_tree ()
+    {
+        std::uniform_int_distribution<int> coin (0, 1);
+
+        for (int cy = 0; cy < cells_h_; cy++)
+          for (int cx = 0; cx < cells_w_; cx++)
+            {
+              carve (cx, cy);
+
+              if (cx > 0 && cy > 0)
+                {
+                  if (coin (rng_))
+                    connect (cx, cy, 0, -1);
+                  else
+                    connect (cx, cy, -1, 0);
+                }
+
+              else if (cy > 0)
+                connect (cx, cy, 0, -1);
+
+              else if (cx > 0)
+                connect (cx, cy, -1, 0);
+            }
+    }
+
+    // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+    // @brief Sidewinder algorithm.
+    //
+    // The first row is a single corridor. On the other rows, runs of cells
+    // are joined eastwards, and each run opens north from one random cell.
+    // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+    void
+    sidewinder ()
+    {
+        std::uniform_int_distribution<int> coin (0, 1);
+
+        for (int cy = 0; cy < cells_h_; cy++)
+          {
+            int run_start = 0;
+
+            for (int cx = 0; cx < cells_w_; cx++)
+              {
+                carve (cx, cy);
+
+                if (cy == 0)
+                  {
+                    if (cx + 1 < cells_w_)
+                      connect (cx, cy, 1, 0);
+                  }
+
+                else if (cx + 1 < cells_w_ && coin (rng_))
+                  connect (cx, cy, 1, 0);
+
+                else
+                  {
+                    std::uniform_int_distribution<int> dist (run_start, cx);
+                    connect (dist (rng_), cy, 0, -1);
+                    run_start = cx + 1;
+                  }
+              }
+          }
+    }
+
+private:
+    // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+    // @brief Marks a grid cell as passage and shuffles its exploration order.
+    // @param x X-coordinate of the cell.
+    // @param y Y-coordinate of the cell.
+    // @return Direction indexes (into dir_x/dir_y), packed 2 bits each.
+    // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+    std::uint16_t
+    enter_cell (int x, int y)
+    {
+        grid_.set (x, y, maze::PASSAGE);
+
+        int order[4] = {0, 1, 2, 3};
+
+        // Shuffle directions for random exploration
+        for (int i = 3; i > 0; --i)
+          {
+            std::uniform_int_distribution<int> dist (0, i);
+            int j = dist (rng_);
+            std::swap (order[i], order[j]);
+          }
+
+        return order[0] | (order[1] << 2) | (order[2] << 4) | (order[3] << 6);
+    }
+
+    bool
+    in_bounds (int x, int y) const
+    {
+        return x >= 0 && x < width_ && y >= 0 && y < height_;
+    }
+
+    bool
+    is_cell (int cx, int cy) const
+    {
+        return cx >= 0 && cx < cells_w_ && cy >= 0 && cy < cells_h_;
+    }
+
+    bool
+    is_carved (int cx, int cy) const
+    {
+        return grid_.get (2 * cx + 1, 2 * cy + 1) == maze::PASSAGE;
+    }
+
+    void
+    carve (int cx, int cy)
+    {
+        grid_.set (2 * cx + 1, 2 * cy + 1, maze::PASSAGE);
+    }
+
+    void
+    connect (int cx, int cy, int dx, int dy)
+    {
+        grid_.set (2 * cx + 1 + dx, 2 * cy + 1 + dy, maze::PASSAGE);
+    }
+
+    template <typename T>
+    void
+    shuffle (std::vector <T>& v)
+    {
+        for (std::size_t i = v.size (); i > 1; --i)
+          {
+            std::uniform_int_distribution<std::size_t> dist (0, i - 1);
+            std::swap (v[i - 1], v[dist (rng_)]);
+          }
+    }
+
+    Grid& grid_;                            ///< Grid being carved
+    int width_;                             ///< Grid width
+    int height_;                            ///< Grid height
+    int cells_w_;                           ///< Cells per row
+    int cells_h_;                           ///< Cell rows
+    std::mt19937& rng_;                     ///< Random number generator
+};
+
+} // namespace allegropp
+
+#endif
@@ -0,0 +1,313 @@
+#ifndef ALLEGROPP_MAZE_GRID
+#define ALLEGROPP_MAZE_GRID
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @author      Eduardo Aguiar <aguiar@protonmail.ch>
+// @copyright   Copyright (c) 2025 Eduardo Aguiar
+//
+// This file is part of Allegro++.
+// 
+// Allegro++ is free software: you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+// 
+// You should have received a copy of the GNU Lesser General Public License
+// along with Allegro++. If not, see <https://www.gnu.org/licenses/>.
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+#include <allegropp/maze.hpp>
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+namespace allegropp
+{
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @class maze_byte_grid
+// @brief Maze storage with one byte per cell (BYTE_STORAGE).
+//
+// Supports every wall type. Cells are stored row-major, either in the grid
+// itself or in external memory such as a mapped maze file.
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+class maze_byte_grid
+{
+public:
+    maze_byte_grid (int w, int h)
+      : width_ (w), cells_ (std::size_t (w) * h, maze::WALL), data_ (cells_.data ())
+    {
+    }
+
+    // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+    // @brief Uses external cell data (e.g. a mapped file) without copying.
+    // @param w Grid width.
+    // @param data Cell data, row-major, writable.
+    // @param owner Keeps data alive.
+    // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+    maze_byte_grid (int w, void *data, std::shared_ptr <void> owner)
+      : width_ (w), data_ (static_cast <maze::wall_type *> (data)), owner_ (std::move (owner))
+    {
+    }
+
+    maze_byte_grid (maze_byte_grid&&) = default;
+    maze_byte_grid& operator= (maze_byte_grid&&) = default;
+
+    maze::wall_type
+    get (int x, int y) const
+    {
+        return data_[std::size_t (y) * width_ + x];
+    }
+
+    void
+    set (int x, int y, maze::wall_type type)
+    {
+        data_[std::size_t (y) * width_ + x] = type;
+    }
+
+    const void *
+    get_data () const
+    {
+        return data_;
+    }
+
+private:
+    int width_;                             ///< Grid width (columns)
+    std::vector <maze::wall_type> cells_;   ///< Owned cell data, row-major
+    maze::wall_type *data_;                 ///< Cell data (cells_ or external)
+    std::shared_ptr <void> owner_;          ///< Owner of external cell data
+};
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @class maze_bit_grid
+// @brief Maze storage with one bit per cell (BIT_STORAGE).
+//
+// Only PASSAGE (0) and WALL (1) can be stored. Each row starts on a 64-bit
+// word boundary, so row scans never straddle two rows. Like maze_byte_grid,
+// the words can live in external memory.
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+class maze_bit_grid
+{
+public:
+    maze_bit_grid (int w, int h)
+      : words_per_row_ (get_words_per_row (w)),
+        words_ (words_per_row_ * h, ~std::uint64_t (0)),
+        data_ (words_.data ())
+    {
+    }
+
+    // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+    // @brief Uses external words (e.g. a mapped file) without copying.
+    // @param w Grid width.
+    // @param data Words, get_words_per_row (w) per row, writable.
+    // @param owner Keeps data alive.
+    // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+    maze_bit_grid (int w, void *data, std::shared_ptr <void> owner)
+      : words_per_row_ (get_words_per_row (w)),
+        data_ (static_cast <std::uint64_t *> (data)),
+        owner_ (std::move (owner))
+    {
+    }
+
+    maze_bit_grid (maze_bit_grid&&) = default;
+    maze_bit_grid& operator= (maze_bit_grid&&) = default;
+
+    static std::size_t
+    get_words_per_row (int w)
+    {
+        return (std::size_t (w) + 63) / 64;
+    }
+
+    maze::wall_type
+    get (int x, int y) const
+    {
+        return maze::wall_type ((data_[index (x, y)] >> (x & 63)) & 1);
+    }
+
+    const void *
+    get_data () const
+    {
+        return data_;
+    }
+
+    void
+    set (int x, int y, maze::wall_type type)
+    {
+        const std::uint64_t mask = std::uint64_t (1) << (x & 63);
+
+        if (type == maze::PASSAGE)
+          data_[index (x, y)] &= ~mask;
+
+        else if (type == maze::WALL)
+          data_[index (x, y)] |= mask;
+
+        else
+          throw std::invalid_argument ("wall type not supported by BIT_STORAGE");
+    }
+
+private:
+    std::size_t
+    index (int x, int y) const
+    {
+        return std::size_t (y) * words_per_row_ + (x >> 6);
+    }
+
+    std::size_t words_per_row_;             ///< 64-bit words per row
+    std::vector <std::uint64_t> words_;     ///< Owned cell bits, 1 = WALL
+    std::uint64_t *data_;                   ///< Cell bits (words_ or external)
+    std::shared_ptr <void> owner_;          ///< Owner of external cell bits
+};
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @class maze_rle_grid
+// @brief Run-length encoded maze storage (RLE_STORAGE).
+//
+// Each row holds a sorted list of runs of non-passage cells, so memory is
+// proportional to the number of wall runs rather than to the grid area.
+// Adjacent runs of the same wall type are always merged. Lookups are a
+// binary search within the row.
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+class maze_rle_grid
+{
+public:
+    // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+    // @brief Run of cells [begin, end) with the same wall type
+    // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+    struct run
+    {
+        int begin;
+        int end;
+        maze::wall_type type;
+    };
+
+    maze_rle_grid (int w, int h)
+      : rows_ (h, std::vector <run> {{0, w, maze::WALL}})
+    {
+    }
+
+    explicit maze_rle_grid (std::vector <std::vector <run>> rows)
+      : rows_ (std::move (rows))
+    {
+    }
+
+    // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+    // @brief Encodes another grid.
+    // @param grid Source grid.
+    // @param w Grid width.
+    // @param h Grid height.
+    // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+    template <typename Grid>
+    maze_rle_grid (const Grid& grid, int w, int h)
+      : rows_ (h)
+    {
+        for (int y = 0; y < h; y++)
+          {
+            auto& runs = rows_[y];
+
+            for (int x = 0; x < w; x++)
+              {
+                maze::wall_type type = grid.get (x, y);
+
+                if (type == maze::PASSAGE)
+                  continue;
+
+                if (!runs.empty () && runs.back ().end == x && runs.back ().type == type)
+                  runs.back ().end++;
+
+                else
+                  runs.push_back ({x, x + 1, type});
+              }
+
+            runs.shrink_to_fit ();
+          }
+    }
+
+    maze::wall_type
+    get (int x, int y) const
+    {
+        const auto& runs = rows_[y];
+        auto it = find (runs, x);
+
+        if (it != runs.begin () && std::prev (it)->end > x)
+          return std::prev (it)->type;
+
+        return maze::PASSAGE;
+    }
+
+    void
+    set (int x, int y, maze::wall_type type)
+    {
+        auto& runs = rows_[y];
+        auto it = find (runs, x);
+
+        // Cut cell x out of the run containing it, if any
+        if (it != runs.begin () && std::prev (it)->end > x)
+          {
+            run r = *std::prev (it);
+
+            if (r.type == type)
+              return;
+
+            it = runs.erase (std::prev (it));
+
+            if (x + 1 < r.end)
+              it = runs.insert (it, run {x + 1, r.end, r.type});
+
+            if (r.begin < x)
+              it = std::next (runs.insert (it, run {r.begin, x, r.type}));
+          }
+
+        if (type == maze::PASSAGE)
+          return;
+
+        // Insert cell x, merging with its neighbours
+        bool merge_prev = it != runs.begin () && std::prev (it)->end == x && std::prev (it)->type == type;
+        bool merge_next = it != runs.end () && it->begin == x + 1 && it->type == type;
+
+        if (merge_prev && merge_next)
+          {
+            std::prev (it)->end = it->end;
+            runs.erase (it);
+          }
+
+        else if (merge_prev)
+          std::prev (it)->end = x + 1;
+
+        else if (merge_next)
+          it->begin = x;
+
+        else
+          runs.insert (it, run {x, x + 1, type});
+    }
+
+    const std::vector <std::vector <run>>&
+    get_rows () const
+    {
+        return rows_;
+    }
+
+private:
+    // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+    // @brief Finds the first run starting after x.
+    // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+    template <typename Runs>
+    static auto
+    find (Runs& runs, int x) -> decltype (runs.begin ())
+    {
+        return std::upper_bound (runs.begin (), runs.end (), x,
+            [](int value, const run& r) { return value < r.begin; });
+    }
+
+    std::vector <std::vector <run>> rows_;  ///< Wall runs, per row
+};
+
+} // namespace allegropp
+
+#endif
@@ -0,0 +1,285 @@
+#ifndef ALLEGROPP_MAZE_IMPL
+#define ALLEGROPP_MAZE_IMPL
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @author      Eduardo Aguiar <aguiar@protonmail.ch>
+// @copyright   Copyright (c) 2025 Eduardo Aguiar
+//
+// This file is part of Allegro++.
+// 
+// Allegro++ is free software: you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+// 
+// You should have received a copy of the GNU Lesser General Public License
+// along with Allegro++. If not, see <https://www.gnu.org/licenses/>.
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+#include <allegropp/maze.hpp>
+#include "maze_file.hpp"
+#include "maze_generator.hpp"
+#include "maze_grid.hpp"
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <vector>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <variant>
+
+namespace allegropp
+{
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @struct maze::Impl
+// @brief Private implementation details of the maze class (PIMPL).
+//
+// Contains the maze grid, dimensions and random number generator. Generation
+// algorithms live in maze_generator.
+// Hidden from the public interface to reduce coupling and improve encapsulation.
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+struct maze::impl
+{
+    using grid_type = std::variant <maze_byte_grid, maze_bit_grid, maze_rle_grid>;
+
+    /// Number of changes kept in the journal
+    static constexpr std::uint64_t JOURNAL_SIZE = 4096;
+
+    /// Tile side in cells for tiled generation (512 grid columns, so tiles
+    /// never share a BIT_STORAGE word)
+    static constexpr int TILE_CELLS = 256;
+
+    int width;                          ///< Grid width (columns)
+    int height;                         ///< Grid height (rows)
+    storage_type storage;               ///< Storage backend of the grid
+    generator_type generator;           ///< Generation algorithm
+    int threads;                        ///< Generation threads (1 = untiled)
+    grid_type walls;                    ///< Grid data: 0 = passage, >0 = wall types
+    std::mt19937 rng;                   ///< Mersenne Twister random number generator
+    unsigned int seed;                  ///< Seed value for reproducible generation
+    std::uint64_t revision = 0;         ///< Number of cell changes made by maze::set
+    std::vector <std::uint32_t> journal;    ///< Last JOURNAL_SIZE changed cells (ring buffer)
+
+    // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+    // @brief Checks if a position is within the maze bounds.
+    // @param x X-coordinate to check.
+    // @param y Y-coordinate to check.
+    // @return True if (x, y) is within bounds, false otherwise.
+    // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+    bool
+    in_bounds (int x, int y) const
+    {
+        return x >= 0 && x < width && y >= 0 && y < height;
+    }
+
+    // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+    // @brief Records a cell change in the journal.
+    // @param x X-coordinate of the changed cell.
+    // @param y Y-coordinate of the changed cell.
+    //
+    // Companion classes remember the revision they last saw and replay the
+    // journal from there, falling back to a full rebuild when more than
+    // JOURNAL_SIZE changes were made in between.
+    // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+    void
+    record_change (int x, int y)
+    {
+        if (journal.empty ())
+          journal.resize (JOURNAL_SIZE);
+
+        journal[revision % JOURNAL_SIZE] = std::uint32_t (y) * width + x;
+        revision++;
+    }
+
+    // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+    // @brief Constructs the implementation with given dimensions and seed.
+    // @param w Desired width (adjusted to odd).
+    // @param h Desired height (adjusted to odd).
+    // @param s Seed value; if 0, generates a random seed.
+    // @param st Storage backend.
+    // @param g Generation algorithm.
+    // @param t Generation threads.
+    //
+    // Byte and bit grids are carved in place. RLE grids are carved into a
+    // bit grid first, since carving needs cheap random access, then encoded.
+    // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+    impl (int w, int h, unsigned int s, storage_type st, generator_type g, int t)
+      : width (w + (w % 2 == 0)),       // Ensure odd dimensions for a wall border
+        height (h + (h % 2 == 0)),
+        storage (st),
+        generator (g),
+        threads (t),
+        walls (make_grid (width, height, st))
+    {
+        // Set seed: random if 0, otherwise use provided value
+        if (s)
+          seed = s;
+
+        else
+          {
+            std::random_device rd;
+            seed = rd();
+          }
+
+        rng.seed (seed);
+
+        // Generate maze
+        if (storage == RLE_STORAGE)
+          {
+            maze_bit_grid grid (width, height);
+            generate (grid);
+            walls = maze_rle_grid (grid, width, height);
+          }
+
+        else
+          std::visit ([&](auto& grid) { generate (grid); }, walls);
+    }
+
+    // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+    // @brief Constructs the implementation from a loaded maze file.
+    // @param header File header, already validated.
+    // @param g Grid holding the file cells.
+    // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+    impl (const maze_file_header& header, grid_type&& g)
+      : width (int (header.width)),
+        height (int (header.height)),
+        storage (storage_type (header.storage)),
+        generator (generator_type (header.generator)),
+        threads (1),
+        walls (std::move (g)),
+        seed (header.seed)
+    {
+        rng.seed (seed);
+    }
+
+    static std::shared_ptr <impl> load (const std::string&);
+    void save (const std::string&) const;
+
+    // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+    // @brief Carves the maze into a grid filled with walls.
+    // @param grid Grid to carve.
+    // @throws std::invalid_argument If the generator type is invalid.
+    // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+    template <typename Grid>
+    void
+    generate (Grid& grid)
+    {
+        if (generator > SIDEWINDER)
+          throw std::invalid_argument ("invalid maze generator type");
+
+        if (threads < 1)
+          throw std::invalid_argument ("invalid maze thread count");
+
+        if (threads == 1)
+          maze_generator <Grid> (grid, width, height, rng).run (generator);
+
+        else
+          generate_tiled (grid);
+    }
+
+    // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+    // @brief Carves the maze tile by tile on worker threads.
+    // @param grid Grid to carve.
+    //
+    // Each tile of TILE_CELLS x TILE_CELLS cells is a perfect maze of its own,
+    // generated from a seed derived from the maze seed and the tile index.
+    // The tiles are then joined by one random passage per edge of a spanning
+    // tree over the tiles, itself generated as a small maze of tiles. Tiles
+    // only depend on the maze size, so the result is the same for any thread
+    // count above one.
+    // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+    template <typename Grid>
+    void
+    generate_tiled (Grid& grid)
+    {
+        const int cells_w = (width - 1) / 2;
+        const int cells_h = (height - 1) / 2;
+        const int tiles_w = (cells_w + TILE_CELLS - 1) / TILE_CELLS;
+        const int tiles_h = (cells_h + TILE_CELLS - 1) / TILE_CELLS;
+        const std::size_t tiles = std::size_t (tiles_w) * tiles_h;
+
+        // Generate tiles
+        std::atomic <std::size_t> next_tile (0);
+
+        auto worker = [&]()
+        {
+            for (std::size_t i = next_tile++; i < tiles; i = next_tile++)
+              {
+                const int cx = int (i % tiles_w) * TILE_CELLS;
+                const int cy = int (i / tiles_w) * TILE_CELLS;
+                const int tile_w = std::min (TILE_CELLS, cells_w - cx);
+                const int tile_h = std::min (TILE_CELLS, cells_h - cy);
+
+                std::seed_seq seq {seed, unsigned (i)};
+                std::mt19937 tile_rng (seq);
+                maze_tile_view <Grid> view (grid, 2 * cx, 2 * cy);
+                maze_generator <maze_tile_view <Grid>> (view, 2 * tile_w + 1, 2 * tile_h + 1, tile_rng).run (generator);
+              }
+        };
+
+        std::vector <std::thread> pool;
+        const std::size_t count = std::min (std::size_t (threads), tiles);
+
+        for (std::size_t i = 1; i < count; i++)
+          pool.emplace_back (worker);
+
+        worker ();
+
+        for (auto& t : pool)
+          t.join ();
+
+        // Join tiles along a spanning tree
+        maze_byte_grid tree (2 * tiles_w + 1, 2 * tiles_h + 1);
+        maze_generator <maze_byte_grid> (tree, 2 * tiles_w + 1, 2 * tiles_h + 1, rng).run (generator);
+
+        for (int ty = 0; ty < tiles_h; ty++)
+          for (int tx = 0; tx < tiles_w; tx++)
+            {
+              const int cx = tx * TILE_CELLS;
+              const int cy = ty * TILE_CELLS;
+
+              if (tx + 1 < tiles_w && tree.get (2 * tx + 2, 2 * ty + 1) == PASSAGE)
+                {
+                  std::uniform_int_distribution<int> dist (cy, std::min (cy + TILE_CELLS, cells_h) - 1);
+                  grid.set (2 * (cx + TILE_CELLS), 2 * dist (rng) + 1, PASSAGE);
+                }
+
+              if (ty + 1 < tiles_h && tree.get (2 * tx + 1, 2 * ty + 2) == PASSAGE)
+                {
+                  std::uniform_int_distribution<int> dist (cx, std::min (cx + TILE_CELLS, cells_w) - 1);
+                  grid.set (2 * dist (rng) + 1, 2 * (cy + TILE_CELLS), PASSAGE);
+                }
+            }
+    }
+
+    // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+    // @brief Creates a grid filled with standard walls.
+    // @param w Grid width.
+    // @param h Grid height.
+    // @param st Storage backend.
+    // @return New grid.
+    // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+    static grid_type
+    make_grid (int w, int h, storage_type st)
+    {
+        switch (st)
+          {
+            case BYTE_STORAGE: return maze_byte_grid (w, h);
+            case BIT_STORAGE: return maze_bit_grid (w, h);
+            case RLE_STORAGE: return maze_rle_grid (w, h);
+          }
+
+        throw std::invalid_argument ("invalid maze storage type");
+    }
+};
+
+} // namespace allegropp
+
+#endif
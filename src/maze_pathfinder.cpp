@@ -0,0 +1,508 @@
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @author      Eduardo Aguiar <aguiar@protonmail.ch>
+// @copyright   Copyright (c) 2025 Eduardo Aguiar
+//
+// This file is part of Allegro++.
+// 
+// Allegro++ is free software: you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+// 
+// You should have received a copy of the GNU Lesser General Public License
+// along with Allegro++. If not, see <https://www.gnu.org/licenses/>.
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+#include <allegropp/maze_pathfinder.hpp>
+#include "maze_impl.hpp"
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstdlib>
+#include <variant>
+
+namespace allegropp
+{
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @struct maze_pathfinder::impl
+// @brief Private implementation details of the maze_pathfinder class (PIMPL).
+//
+// Per-cell state (cost and parent) is only valid when the cell's stamp
+// matches the current query number, so buffers are never cleared between
+// queries.
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+struct maze_pathfinder::impl
+{
+    // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+    // @brief Open list entry
+    // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+    struct node
+    {
+        int f;                          ///< Cost plus heuristic
+        int g;                          ///< Cost from start
+        std::uint32_t index;            ///< Cell index
+
+        // Heap order: lowest f first, then highest g (closest to goal)
+        bool operator< (const node& other) const
+        {
+            return f > other.f || (f == other.f && g < other.g);
+        }
+    };
+
+    std::shared_ptr <maze::impl> maze_;     ///< Maze being searched
+    std::vector <std::uint32_t> stamp;      ///< Query number per cell
+    std::vector <int> cost;                 ///< Cost from start per cell
+    std::vector <std::uint32_t> parent;     ///< Parent cell index per cell
+    std::vector <std::uint32_t> queue;      ///< BFS queue
+    std::vector <node> open;                ///< A*/JPS open list (binary heap)
+    std::uint32_t query = 0;                ///< Current query number
+    std::size_t expanded = 0;               ///< Nodes expanded by last query
+    int goal_x = 0;                         ///< Current goal X-coordinate
+    int goal_y = 0;                         ///< Current goal Y-coordinate
+
+    explicit impl (const std::shared_ptr <maze::impl>& m)
+      : maze_ (m)
+    {
+    }
+
+    // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+    // @brief Starts a new query, invalidating all per-cell state.
+    // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+    void
+    begin_query ()
+    {
+        const std::size_t cells = std::size_t (maze_->width) * maze_->height;
+
+        if (stamp.size () != cells)
+          {
+            stamp.assign (cells, 0);
+            cost.resize (cells);
+            parent.resize (cells);
+            query = 0;
+          }
+
+        if (++query == 0)
+          {
+            std::fill (stamp.begin (), stamp.end (), 0);
+            query = 1;
+          }
+
+        expanded = 0;
+    }
+
+    std::uint32_t
+    index (int x, int y) const
+    {
+        return std::uint32_t (y) * maze_->width + x;
+    }
+
+    template <typename Grid>
+    bool
+    is_open (const Grid& grid, int x, int y) const
+    {
+        return maze_->in_bounds (x, y) && grid.get (x, y) == maze::PASSAGE;
+    }
+
+    // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+    // @brief Breadth-first search distance.
+    // @return Number of steps from (x0, y0) to (x1, y1), or -1 if unreachable.
+    // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+    template <typename Grid>
+    int
+    bfs (const Grid& grid, int x0, int y0, int x1, int y1)
+    {
+        static constexpr int dir_x[4] = {0, 1, 0, -1};
+        static constexpr int dir_y[4] = {-1, 0, 1, 0};
+
+        begin_query ();
+
+        if (!is_open (grid, x0, y0) || !is_open (grid, x1, y1))
+          return -1;
+
+        const std::uint32_t goal = index (x1, y1);
+
+        queue.clear ();
+        queue.push_back (index (x0, y0));
+        stamp[queue[0]] = query;
+        cost[queue[0]] = 0;
+
+        for (std::size_t head = 0; head < queue.size (); head++)
+          {
+            const std::uint32_t i = queue[head];
+            expanded++;
+
+            if (i == goal)
+              return cost[i];
+
+            const int x = i % maze_->width;
+            const int y = i / maze_->width;
+
+            for (int d = 0; d < 4; d++)
+              {
+                const int nx = x + dir_x[d];
+                const int ny = y + dir_y[d];
+
+                if (is_open (grid, nx, ny) && stamp[index (nx, ny)] != query)
+                  {
+                    const std::uint32_t n = index (nx, ny);
+                    stamp[n] = query;
+                    cost[n] = cost[i] + 1;
+                    queue.push_back (n);
+                  }
+              }
+          }
+
+        return -1;
+    }
+
+    // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+    // @brief Best-first search shared by A* and JPS.
+    // @param expand Callable (grid, cell index, emit) calling emit (successor)
+    //               for each successor of a cell. Successors must lie on a
+    //               straight line from the cell.
+    //
+    // Nodes are reopened whenever a cheaper path is found, so inconsistent
+    // heuristics still give correct (if slower) results when admissible.
+    // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+    template <typename Grid, typename Expand>
+    bool
+    search (const Grid& grid, int x0, int y0, int x1, int y1, heuristic_type h, Expand expand, path_type& path)
+    {
+        begin_query ();
+        path.clear ();
+
+        if (!is_open (grid, x0, y0) || !is_open (grid, x1, y1))
+          return false;
+
+        const std::uint32_t start = index (x0, y0);
+        const std::uint32_t goal = index (x1, y1);
+        goal_x = x1;
+        goal_y = y1;
+
+        stamp[start] = query;
+        cost[start] = 0;
+        parent[start] = start;
+
+        open.clear ();
+        open.push_back ({h (std::abs (x1 - x0), std::abs (y1 - y0)), 0, start});
+
+        while (!open.empty ())
+          {
+            std::pop_heap (open.begin (), open.end ());
+            const node n = open.back ();
+            open.pop_back ();
+
+            // Skip entries superseded by a cheaper path
+            if (n.g != cost[n.index])
+              continue;
+
+            expanded++;
+
+            if (n.index == goal)
+              {
+                build_path (start, goal, path);
+                return true;
+              }
+
+            const int x = n.index % maze_->width;
+            const int y = n.index / maze_->width;
+
+            expand (grid, n.index, [&](std::uint32_t s)
+            {
+                const int sx = s % maze_->width;
+                const int sy = s / maze_->width;
+                const int g = n.g + std::abs (sx - x) + std::abs (sy - y);
+
+                if (stamp[s] != query || g < cost[s])
+                  {
+                    stamp[s] = query;
+                    cost[s] = g;
+                    parent[s] = n.index;
+                    open.push_back ({g + h (std::abs (x1 - sx), std::abs (y1 - sy)), g, s});
+                    std::push_heap (open.begin (), open.end ());
+                  }
+            });
+          }
+
+        return false;
+    }
+
+    // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+    // @brief Walks parents back from goal, filling in straight segments.
+    // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+    void
+    build_path (std::uint32_t start, std::uint32_t goal, path_type& path) const
+    {
+        for (std::uint32_t i = goal; i != start; i = parent[i])
+          {
+            int x = i % maze_->width;
+            int y = i / maze_->width;
+            const int px = parent[i] % maze_->width;
+            const int py = parent[i] / maze_->width;
+            const int step_x = (px > x) - (px < x);
+            const int step_y = (py > y) - (py < y);
+
+            while (x != px || y != py)
+              {
+                path.emplace_back (x, y);
+                x += step_x;
+                y += step_y;
+              }
+          }
+
+        path.emplace_back (start % maze_->width, start / maze_->width);
+        std::reverse (path.begin (), path.end ());
+    }
+
+    // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+    // @brief Checks whether a horizontal step into (x, y) has a forced
+    //        vertical neighbour, i.e. an opening at (x, y + dy) that the
+    //        cell behind, (x - dx, y + dy), does not share.
+    // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+    template <typename Grid>
+    bool
+    is_forced (const Grid& grid, int x, int y, int dx, int dy) const
+    {
+        return is_open (grid, x, y + dy) && !is_open (grid, x - dx, y + dy);
+    }
+
+    // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+    // @brief Jumps horizontally from (x, y).
+    // @return True if a jump point was found; (x, y) is updated to it.
+    //
+    // Stops at the goal or at a cell with a forced vertical neighbour.
+    // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+    template <typename Grid>
+    bool
+    jump_horizontal (const Grid& grid, int& x, int y, int dx) const
+    {
+        for (int cx = x + dx; is_open (grid, cx, y); cx += dx)
+          {
+            if ((cx == goal_x && y == goal_y) ||
+                is_forced (grid, cx, y, dx, -1) || is_forced (grid, cx, y, dx, 1))
+              {
+                x = cx;
+                return true;
+              }
+          }
+
+        return false;
+    }
+
+    // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+    // @brief Jumps vertically from (x, y).
+    // @return True if a jump point was found; (x, y) is updated to it.
+    //
+    // Vertical moves play the role diagonal moves have in 8-connected JPS:
+    // every cell scans both horizontal directions, and becomes a jump point
+    // when one of these scans finds one.
+    // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+    template <typename Grid>
+    bool
+    jump_vertical (const Grid& grid, int x, int& y, int dy) const
+    {
+        for (int cy = y + dy; is_open (grid, x, cy); cy += dy)
+          {
+            int hx = x;
+
+            if ((x == goal_x && cy == goal_y) ||
+                jump_horizontal (grid, hx, cy, 1) || jump_horizontal (grid, hx, cy, -1))
+              {
+                y = cy;
+                return true;
+              }
+          }
+
+        return false;
+    }
+
+    // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+    // @brief Emits JPS successors of a cell, pruned by the travel direction.
+    // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+    template <typename Grid, typename Emit>
+    void
+    expand_jps (const Grid& grid, std::uint32_t i, Emit emit) const
+    {
+        const int x = i % maze_->width;
+        const int y = i / maze_->width;
+        const int px = parent[i] % maze_->width;
+        const int py = parent[i] / maze_->width;
+        const int dx = (x > px) - (x < px);
+        const int dy = (y > py) - (y < py);
+
+        auto horizontal = [&](int d)
+        {
+            int jx = x;
+
+            if (jump_horizontal (grid, jx, y, d))
+              emit (index (jx, y));
+        };
+
+        auto vertical = [&](int d)
+        {
+            int jy = y;
+
+            if (jump_vertical (grid, x, jy, d))
+              emit (index (x, jy));
+        };
+
+        // Start cell: all directions
+        if (dx == 0 && dy == 0)
+          {
+            horizontal (1);
+            horizontal (-1);
+            vertical (1);
+            vertical (-1);
+          }
+
+        // Vertical travel: keep going and scan both sides
+        else if (dx == 0)
+          {
+            vertical (dy);
+            horizontal (1);
+            horizontal (-1);
+          }
+
+        // Horizontal travel: keep going, plus forced neighbours
+        else
+          {
+            horizontal (dx);
+
+            if (is_forced (grid, x, y, dx, -1))
+              vertical (-1);
+
+            if (is_forced (grid, x, y, dx, 1))
+              vertical (1);
+          }
+    }
+
+    // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+    // @brief Emits the open 4-neighbours of a cell (plain A*).
+    // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+    template <typename Grid, typename Emit>
+    void
+    expand_astar (const Grid& grid, std::uint32_t i, Emit emit) const
+    {
+        static constexpr int dir_x[4] = {0, 1, 0, -1};
+        static constexpr int dir_y[4] = {-1, 0, 1, 0};
+
+        const int x = i % maze_->width;
+        const int y = i / maze_->width;
+
+        for (int d = 0; d < 4; d++)
+          if (is_open (grid, x + dir_x[d], y + dir_y[d]))
+            emit (index (x + dir_x[d], y + dir_y[d]));
+    }
+};
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @brief Manhattan distance heuristic (exact on an open 4-connected grid).
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+int
+maze_pathfinder::manhattan (int dx, int dy)
+{
+    return dx + dy;
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @brief Euclidean distance heuristic, rounded down.
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+int
+maze_pathfinder::euclidean (int dx, int dy)
+{
+    return int (std::sqrt (double (dx) * dx + double (dy) * dy));
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @brief Null heuristic, turning A* into Dijkstra's algorithm.
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+int
+maze_pathfinder::zero (int, int)
+{
+    return 0;
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @brief Constructs a pathfinder for a maze.
+// @param m Maze to search. The pathfinder shares it, so later maze::set calls
+//          are visible to queries.
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+maze_pathfinder::maze_pathfinder (const maze& m)
+    : impl_ (std::make_shared<impl> (m.impl_))
+{
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @brief Gets the shortest path length between two cells, using BFS.
+// @param x0 Start X-coordinate.
+// @param y0 Start Y-coordinate.
+// @param x1 Goal X-coordinate.
+// @param y1 Goal Y-coordinate.
+// @return Number of steps, or -1 if the goal is unreachable.
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+int
+maze_pathfinder::get_bfs_distance (int x0, int y0, int x1, int y1)
+{
+    return std::visit ([&](const auto& grid) {
+        return impl_->bfs (grid, x0, y0, x1, y1);
+    }, impl_->maze_->walls);
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @brief Finds a shortest path between two cells, using A*.
+// @param x0 Start X-coordinate.
+// @param y0 Start Y-coordinate.
+// @param x1 Goal X-coordinate.
+// @param y1 Goal Y-coordinate.
+// @param path Receives the cells from start to goal, both included.
+// @param h Admissible heuristic (default: manhattan).
+// @return True if a path was found, false otherwise.
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+bool
+maze_pathfinder::find_path_astar (int x0, int y0, int x1, int y1, path_type& path, heuristic_type h)
+{
+    return std::visit ([&](const auto& grid) {
+        return impl_->search (grid, x0, y0, x1, y1, h,
+            [this](const auto& g, std::uint32_t i, auto emit) { impl_->expand_astar (g, i, emit); },
+            path);
+    }, impl_->maze_->walls);
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @brief Finds a shortest path between two cells, using Jump Point Search.
+// @param x0 Start X-coordinate.
+// @param y0 Start Y-coordinate.
+// @param x1 Goal X-coordinate.
+// @param y1 Goal Y-coordinate.
+// @param path Receives the cells from start to goal, both included.
+// @return True if a path was found, false otherwise.
+//
+// @details JPS only adds jump points to the open list, skipping the runs of
+// cells in between. This pays off most in corridor mazes, where each
+// corridor is crossed in a single jump.
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+bool
+maze_pathfinder::find_path_jps (int x0, int y0, int x1, int y1, path_type& path)
+{
+    return std::visit ([&](const auto& grid) {
+        return impl_->search (grid, x0, y0, x1, y1, manhattan,
+            [this](const auto& g, std::uint32_t i, auto emit) { impl_->expand_jps (g, i, emit); },
+            path);
+    }, impl_->maze_->walls);
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @brief Gets the number of nodes expanded by the last query.
+// @return Expanded node count.
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+std::size_t
+maze_pathfinder::get_expanded_nodes () const
+{
+    return impl_->expanded;
+}
+
+} // namespace allegropp
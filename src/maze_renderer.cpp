@@ -0,0 +1,330 @@
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @author      Eduardo Aguiar <aguiar@protonmail.ch>
+// @copyright   Copyright (c) 2025 Eduardo Aguiar
+//
+// This file is part of Allegro++.
+// 
+// Allegro++ is free software: you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+// 
+// You should have received a copy of the GNU Lesser General Public License
+// along with Allegro++. If not, see <https://www.gnu.org/licenses/>.
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+#include <allegropp/maze_renderer.hpp>
+#include <allegropp/allegropp.hpp>
+#include "maze_impl.hpp"
+#include <allegro5/allegro.h>
+#include <allegro5/allegro_primitives.h>
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstdint>
+#include <variant>
+#include <vector>
+
+namespace allegropp
+{
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @struct maze_renderer::impl
+// @brief Private implementation details of the maze_renderer class (PIMPL).
+//
+// Vertices are in maze coordinates (cell size applied, no offset). The draw
+// position is applied through the current transform, so moving the view
+// never rebuilds a tile.
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+struct maze_renderer::impl
+{
+    /// Tile side in cells
+    static constexpr int TILE_CELLS = 64;
+
+    // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+    // @brief Tile geometry
+    // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+    struct tile
+    {
+        std::vector <ALLEGRO_VERTEX> vertices;      ///< Triangle list
+        ALLEGRO_VERTEX_BUFFER *buffer = nullptr;    ///< Copy of vertices in video memory
+        bool dirty = true;                          ///< Must be rebuilt before drawing
+    };
+
+    std::shared_ptr <maze::impl> maze_;         ///< Maze being drawn
+    float cell_width;                           ///< Cell width in pixels
+    float cell_height;                          ///< Cell height in pixels
+    float gap = 0;                              ///< Gap between cells in pixels
+    std::array <ALLEGRO_COLOR, 256> colors;     ///< Color per wall type
+    int tiles_w;                                ///< Tiles per row
+    int tiles_h;                                ///< Tile rows
+    std::vector <tile> tiles;                   ///< Tiles, row-major
+    std::uint64_t revision;                     ///< Maze revision the tiles reflect
+    bool use_buffers = true;                    ///< False once buffer creation fails
+    std::size_t draw_calls = 0;                 ///< Draw calls made by the last draw
+
+    impl (const std::shared_ptr <maze::impl>& m, float cw, float ch)
+      : maze_ (m),
+        cell_width (cw),
+        cell_height (ch),
+        tiles_w ((m->width + TILE_CELLS - 1) / TILE_CELLS),
+        tiles_h ((m->height + TILE_CELLS - 1) / TILE_CELLS),
+        tiles (std::size_t (tiles_w) * tiles_h),
+        revision (m->revision)
+    {
+        colors.fill (al_map_rgb (255, 255, 255));
+    }
+
+    ~impl ()
+    {
+        for (auto& t : tiles)
+          if (t.buffer)
+            al_destroy_vertex_buffer (t.buffer);
+    }
+
+    void
+    invalidate ()
+    {
+        for (auto& t : tiles)
+          t.dirty = true;
+    }
+
+    // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+    // @brief Marks the tiles changed by maze::set as dirty.
+    // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+    void
+    sync ()
+    {
+        const maze::impl& m = *maze_;
+
+        if (m.revision - revision > maze::impl::JOURNAL_SIZE)
+          invalidate ();
+
+        else
+          for (std::uint64_t r = revision; r < m.revision; r++)
+            {
+              std::uint32_t i = m.journal[r % maze::impl::JOURNAL_SIZE];
+              int x = int (i % m.width);
+              int y = int (i / m.width);
+              tiles[std::size_t (y / TILE_CELLS) * tiles_w + x / TILE_CELLS].dirty = true;
+            }
+
+        revision = m.revision;
+    }
+
+    // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+    // @brief Rebuilds the vertices of a tile.
+    // @param grid Maze grid.
+    // @param t Tile.
+    // @param tx Tile column.
+    // @param ty Tile row.
+    // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+    template <typename Grid>
+    void
+    build (const Grid& grid, tile& t, int tx, int ty)
+    {
+        const int x0 = tx * TILE_CELLS;
+        const int y0 = ty * TILE_CELLS;
+        const int x1 = std::min (x0 + TILE_CELLS, maze_->width);
+        const int y1 = std::min (y0 + TILE_CELLS, maze_->height);
+
+        t.vertices.clear ();
+
+        for (int y = y0; y < y1; y++)
+          for (int x = x0; x < x1;)
+            {
+              const maze::wall_type type = grid.get (x, y);
+              int end = x + 1;
+
+              if (type == maze::PASSAGE)
+                {
+                  x = end;
+                  continue;
+                }
+
+              if (gap == 0)
+                while (end < x1 && grid.get (end, y) == type)
+                  end++;
+
+              add_quad (t, x * cell_width, y * cell_height, end * cell_width - gap, (y + 1) * cell_height - gap, colors[type]);
+              x = end;
+            }
+
+        if (t.buffer)
+          {
+            al_destroy_vertex_buffer (t.buffer);
+            t.buffer = nullptr;
+          }
+
+        if (use_buffers && !t.vertices.empty ())
+          {
+            t.buffer = al_create_vertex_buffer (nullptr, t.vertices.data (), int (t.vertices.size ()), ALLEGRO_PRIM_BUFFER_STATIC);
+            use_buffers = t.buffer != nullptr;
+          }
+
+        t.dirty = false;
+    }
+
+    static void
+    add_quad (tile& t, float x0, float y0, float x1, float y1, ALLEGRO_COLOR c)
+    {
+        const ALLEGRO_VERTEX v[4] = {
+            {x0, y0, 0, 0, 0, c},
+            {x1, y0, 0, 0, 0, c},
+            {x1, y1, 0, 0, 0, c},
+            {x0, y1, 0, 0, 0, c},
+        };
+
+        t.vertices.insert (t.vertices.end (), {v[0], v[1], v[2], v[0], v[2], v[3]});
+    }
+
+    // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+    // @brief Draws the tiles overlapping a rectangle in maze coordinates.
+    // @param x Draw position X.
+    // @param y Draw position Y.
+    // @param cx0 First visible cell column.
+    // @param cy0 First visible cell row.
+    // @param cx1 Last visible cell column.
+    // @param cy1 Last visible cell row.
+    // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+    void
+    draw (float x, float y, int cx0, int cy0, int cx1, int cy1)
+    {
+        draw_calls = 0;
+        sync ();
+
+        const int tx0 = std::max (cx0, 0) / TILE_CELLS;
+        const int ty0 = std::max (cy0, 0) / TILE_CELLS;
+        const int tx1 = std::min (cx1 / TILE_CELLS, tiles_w - 1);
+        const int ty1 = std::min (cy1 / TILE_CELLS, tiles_h - 1);
+
+        if (cx1 < 0 || cy1 < 0 || tx0 > tx1 || ty0 > ty1)
+          return;
+
+        const ALLEGRO_TRANSFORM *current = al_get_current_transform ();
+        ALLEGRO_TRANSFORM saved;
+        ALLEGRO_TRANSFORM transform;
+
+        if (current)
+          saved = *current;
+        else
+          al_identity_transform (&saved);
+
+        al_identity_transform (&transform);
+        al_translate_transform (&transform, x, y);
+        al_compose_transform (&transform, &saved);
+        al_use_transform (&transform);
+
+        std::visit ([&](const auto& grid)
+        {
+            for (int ty = ty0; ty <= ty1; ty++)
+              for (int tx = tx0; tx <= tx1; tx++)
+                {
+                  tile& t = tiles[std::size_t (ty) * tiles_w + tx];
+
+                  if (t.dirty)
+                    build (grid, t, tx, ty);
+
+                  if (t.vertices.empty ())
+                    continue;
+
+                  if (t.buffer)
+                    al_draw_vertex_buffer (t.buffer, nullptr, 0, int (t.vertices.size ()), ALLEGRO_PRIM_TRIANGLE_LIST);
+                  else
+                    al_draw_prim (t.vertices.data (), nullptr, nullptr, 0, int (t.vertices.size ()), ALLEGRO_PRIM_TRIANGLE_LIST);
+
+                  draw_calls++;
+                }
+        }, maze_->walls);
+
+        al_use_transform (&saved);
+    }
+};
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @brief Constructs a renderer for a maze.
+// @param m Maze to draw. Changes made with maze::set are picked up by draw.
+// @param cell_width Cell width in pixels.
+// @param cell_height Cell height in pixels.
+//
+// @details Every wall type is drawn in white until set_color is called.
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+maze_renderer::maze_renderer (const maze& m, float cell_width, float cell_height)
+{
+    allegropp::init ();
+    impl_ = std::make_shared<impl> (m.impl_, cell_width, cell_height);
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @brief Sets the color of a wall type.
+// @param type Wall type.
+// @param c Color.
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+void
+maze_renderer::set_color (maze::wall_type type, const color& c)
+{
+    impl_->colors[type] = c.get_implementation ();
+    impl_->invalidate ();
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @brief Sets the gap left at the right and bottom of each wall cell.
+// @param gap Gap in pixels (0 by default).
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+void
+maze_renderer::set_gap (float gap)
+{
+    impl_->gap = gap;
+    impl_->invalidate ();
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @brief Draws the whole maze to the current target bitmap.
+// @param x X-coordinate of the maze top left corner.
+// @param y Y-coordinate of the maze top left corner.
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+void
+maze_renderer::draw (float x, float y)
+{
+    impl_->draw (x, y, 0, 0, impl_->maze_->width - 1, impl_->maze_->height - 1);
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @brief Draws the part of the maze within a view rectangle.
+// @param x X-coordinate of the maze top left corner.
+// @param y Y-coordinate of the maze top left corner.
+// @param view_x View left, in target coordinates.
+// @param view_y View top, in target coordinates.
+// @param view_width View width.
+// @param view_height View height.
+//
+// @details Culling is done per tile, so a few cells outside the view may
+// still be drawn.
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+void
+maze_renderer::draw (float x, float y, float view_x, float view_y, float view_width, float view_height)
+{
+    const float cw = impl_->cell_width;
+    const float ch = impl_->cell_height;
+
+    impl_->draw (x, y,
+                 int (std::floor ((view_x - x) / cw)),
+                 int (std::floor ((view_y - y) / ch)),
+                 int (std::floor ((view_x + view_width - x) / cw)),
+                 int (std::floor ((view_y + view_height - y) / ch)));
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @brief Gets the number of draw calls made by the last draw.
+// @return Number of primitive draw calls.
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+std::size_t
+maze_renderer::get_draw_calls () const
+{
+    return impl_->draw_calls;
+}
+
+} // namespace allegropp
@@ -0,0 +1,135 @@
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @author      Eduardo Aguiar <aguiar@protonmail.ch>
+// @copyright   Copyright (c) 2025 Eduardo Aguiar
+//
+// This file is part of Allegro++.
+// 
+// Allegro++ is free software: you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+// 
+// You should have received a copy of the GNU Lesser General Public License
+// along with Allegro++. If not, see <https://www.gnu.org/licenses/>.
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+#include <allegropp/maze_row_stream.hpp>
+#include "maze_generator.hpp"
+#include <random>
+
+namespace allegropp
+{
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @struct maze_row_stream::impl
+// @brief Private implementation details of the maze_row_stream class (PIMPL).
+//
+// Each row of cells yields two grid rows: the cells with their east
+// passages, then the walls below them with their south passages.
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+struct maze_row_stream::impl
+{
+    int width;                          ///< Grid width (columns)
+    int height;                         ///< Grid height (rows)
+    unsigned int seed;                  ///< Seed value for reproducible generation
+    int row = 0;                        ///< Next grid row
+    std::mt19937 rng;                   ///< Mersenne Twister random number generator
+    maze_eller_rows cells;              ///< Current row of cells
+
+    impl (int w, int h, unsigned int s)
+      : width (w + (w % 2 == 0)),       // Same adjustment as maze
+        height (h + (h % 2 == 0)),
+        seed (s ? s : std::random_device () ()),
+        rng (seed),
+        cells ((width - 1) / 2, (height - 1) / 2, rng)
+    {
+    }
+};
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @brief Constructs a row stream with specified dimensions and an optional seed.
+// @param width Desired width of the maze (adjusted to odd if even).
+// @param height Desired height of the maze (adjusted to odd if even).
+// @param seed Random seed for generation; if 0, a random seed is generated.
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+maze_row_stream::maze_row_stream (int width, int height, unsigned int seed)
+    : impl_ (std::make_shared<impl> (width, height, seed))
+{
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @brief Generates the next grid row.
+// @param row Receives get_width () cells.
+// @return False if all rows have been generated, true otherwise.
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+bool
+maze_row_stream::get_row (std::vector <maze::wall_type>& row)
+{
+    if (impl_->row == impl_->height)
+      return false;
+
+    const int y = impl_->row++;
+    row.assign (impl_->width, maze::WALL);
+
+    // Cells and their east passages
+    if (y % 2 == 1)
+      {
+        impl_->cells.next ();
+        const auto& east = impl_->cells.get_east ();
+
+        for (int cx = 0; 2 * cx + 1 < impl_->width - 1; cx++)
+          {
+            row[2 * cx + 1] = maze::PASSAGE;
+
+            if (east[cx])
+              row[2 * cx + 2] = maze::PASSAGE;
+          }
+      }
+
+    // South passages of the last row of cells (none above the first row)
+    else if (y > 0)
+      {
+        const auto& south = impl_->cells.get_south ();
+
+        for (int cx = 0; 2 * cx + 1 < impl_->width - 1; cx++)
+          if (south[cx])
+            row[2 * cx + 1] = maze::PASSAGE;
+      }
+
+    return true;
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @brief Gets the width of the maze grid.
+// @return The number of columns in the maze.
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+int
+maze_row_stream::get_width () const
+{
+    return impl_->width;
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @brief Gets the height of the maze grid.
+// @return The number of rows in the maze.
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+int
+maze_row_stream::get_height () const
+{
+    return impl_->height;
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @brief Gets the seed used for maze generation.
+// @return The seed value (user-provided or randomly generated).
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+unsigned int
+maze_row_stream::get_seed () const
+{
+    return impl_->seed;
+}
+
+} // namespace allegropp
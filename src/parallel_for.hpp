@@ -0,0 +1,86 @@
+#ifndef ALLEGROPP_PARALLEL_FOR
+#define ALLEGROPP_PARALLEL_FOR
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @author      Eduardo Aguiar <aguiar@protonmail.ch>
+// @copyright   Copyright (c) 2025 Eduardo Aguiar
+//
+// This file is part of Allegro++.
+// 
+// Allegro++ is free software: you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+// 
+// You should have received a copy of the GNU Lesser General Public License
+// along with Allegro++. If not, see <https://www.gnu.org/licenses/>.
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <exception>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace allegropp
+{
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Run function for items 0..count-1 on a pool of threads
+//! \param threads Maximum number of threads, including the calling one
+//! \param count Number of items
+//! \param f Function, called with each item index
+//!
+//! The first exception thrown by f is rethrown once all threads are done.
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+template <typename F>
+void
+parallel_for (unsigned int threads, std::size_t count, const F& f)
+{
+  std::atomic <std::size_t> next (0);
+  std::exception_ptr error;
+  std::mutex error_mutex;
+
+  auto worker = [&]()
+  {
+    for (std::size_t i = next++; i < count; i = next++)
+      {
+        try
+          {
+            f (i);
+          }
+        catch (...)
+          {
+            std::lock_guard <std::mutex> lock (error_mutex);
+
+            if (!error)
+              error = std::current_exception ();
+
+            next = count;
+          }
+      }
+  };
+
+  std::vector <std::thread> pool;
+  const std::size_t pool_size = std::min (std::size_t (threads), count);
+
+  for (std::size_t i = 1; i < pool_size; i++)
+    pool.emplace_back (worker);
+
+  worker ();
+
+  for (auto& t : pool)
+    t.join ();
+
+  if (error)
+    std::rethrow_exception (error);
+}
+
+} // namespace allegropp
+
+#endif
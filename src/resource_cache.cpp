@@ -0,0 +1,446 @@
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @author      Eduardo Aguiar <aguiar@protonmail.ch>
+// @copyright   Copyright (c) 2025 Eduardo Aguiar
+//
+// This file is part of Allegro++.
+// 
+// Allegro++ is free software: you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+// 
+// You should have received a copy of the GNU Lesser General Public License
+// along with Allegro++. If not, see <https://www.gnu.org/licenses/>.
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+#include <allegropp/resource_cache.hpp>
+#include <allegro5/allegro.h>
+#include <allegro5/allegro_audio.h>
+#include <algorithm>
+#include <filesystem>
+#include <list>
+#include <mutex>
+#include <unordered_map>
+
+namespace
+{
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Get bitmap size estimate
+//! \param b Bitmap
+//! \return Size in bytes
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+std::size_t
+get_size (const allegropp::bitmap& b)
+{
+  ALLEGRO_BITMAP *obj = b.get_implementation ();
+
+  return std::size_t (al_get_bitmap_width (obj)) * std::size_t (al_get_bitmap_height (obj))
+    * std::size_t (al_get_pixel_size (al_get_bitmap_format (obj)));
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Get sample size estimate
+//! \param s Sample
+//! \return Size in bytes
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+std::size_t
+get_size (const allegropp::sample& s)
+{
+  ALLEGRO_SAMPLE *obj = s.get_implementation ();
+
+  return std::size_t (al_get_sample_length (obj)) * std::size_t (al_get_channel_count (al_get_sample_channels (obj)))
+    * std::size_t (al_get_audio_depth_size (al_get_sample_depth (obj)));
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Get file size
+//! \param path File path
+//! \return Size in bytes, or 0 if unknown
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+std::size_t
+get_file_size (const std::string& path)
+{
+  std::error_code ec;
+  const auto size = std::filesystem::file_size (path, ec);
+
+  return ec ? 0 : std::size_t (size);
+}
+
+} // namespace
+
+namespace allegropp
+{
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Get resource implementation pointer
+//! \param r Resource
+//! \return Implementation pointer, type-erased
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+template <typename T>
+std::shared_ptr <void>
+resource_cache::get_pointer (const T& r)
+{
+  return r.impl_;
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Create resource sharing an implementation
+//! \param p Implementation pointer, from get_pointer <T>
+//! \return Resource
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+template <typename T>
+T
+resource_cache::from_pointer (const std::shared_ptr <void>& p)
+{
+  return T (std::static_pointer_cast <typename T::impl> (p));
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief <i>resource_cache</i> implementation class
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+class resource_cache::impl
+{
+public:
+  // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+  // Constructors
+  // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+  explicit impl (std::size_t budget)
+    : budget_ (budget)
+  {
+  }
+
+  impl (const impl&) = delete;
+  impl (impl&&) = delete;
+
+  // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+  // Operators
+  // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+  impl& operator= (const impl&) = delete;
+  impl& operator= (impl&&) = delete;
+
+  // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+  // Prototypes
+  // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+  template <typename T, typename L, typename S> T get (const std::string&, const L&, const S&);
+  void set_budget (std::size_t);
+  std::size_t get_budget () const;
+  statistics get_statistics () const;
+  void reset_statistics ();
+  void clear ();
+
+private:
+  struct entry;
+  using map_type = std::unordered_map <std::string, entry>;
+  using lru_type = std::list <map_type::value_type *>;
+
+  //! \brief Cached resource
+  struct entry
+  {
+    std::weak_ptr <void> weak;          //!< Resource, while in use
+    std::shared_ptr <void> strong;      //!< Resource, while in the LRU list
+    std::size_t bytes = 0;              //!< Size estimate
+    lru_type::iterator lru;             //!< Position in the LRU list
+  };
+
+  void touch (map_type::value_type&, const std::shared_ptr <void>&);
+  void evict ();
+  void purge ();
+
+  mutable std::mutex mutex_;            //!< Guards the fields below
+  map_type entries_;                    //!< Entries by key
+  lru_type lru_;                        //!< Retained entries, most recent first
+  std::size_t budget_;                  //!< Maximum retained bytes
+  std::size_t bytes_ = 0;               //!< Retained bytes
+  std::size_t purge_size_ = 64;         //!< Entry count triggering a purge
+  statistics statistics_;               //!< Counters
+};
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Get resource from cache, loading it on a miss
+//! \param key Cache key
+//! \param load Function loading the resource
+//! \param size Function estimating the resource size
+//! \return Resource. Failed loads are returned but not cached
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+template <typename T, typename L, typename S>
+T
+resource_cache::impl::get (const std::string& key, const L& load, const S& size)
+{
+  std::lock_guard <std::mutex> lock (mutex_);
+
+  // Hit: the resource is in use, or retained
+  auto iter = entries_.find (key);
+
+  if (iter != entries_.end ())
+    {
+      if (auto p = iter->second.weak.lock ())
+        {
+          statistics_.hits++;
+          touch (*iter, p);
+          return from_pointer <T> (p);
+        }
+    }
+
+  // Miss
+  statistics_.misses++;
+
+  T value = load ();
+
+  if (!value)
+    return value;
+
+  auto p = get_pointer (value);
+
+  if (iter == entries_.end ())
+    {
+      if (entries_.size () >= purge_size_)
+        purge ();
+
+      iter = entries_.emplace (key, entry ()).first;
+    }
+
+  iter->second.weak = p;
+  iter->second.bytes = size (value);
+  touch (*iter, p);
+
+  return value;
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Move entry to the front of the LRU list
+//! \param item Map item
+//! \param p Resource
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+void
+resource_cache::impl::touch (map_type::value_type& item, const std::shared_ptr <void>& p)
+{
+  entry& e = item.second;
+
+  if (e.strong)
+    lru_.splice (lru_.begin (), lru_, e.lru);
+
+  else if (budget_ > 0)
+    {
+      e.strong = p;
+      e.lru = lru_.insert (lru_.begin (), &item);
+      bytes_ += e.bytes;
+      evict ();
+    }
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Drop least recently used entries until within budget
+//!
+//! Dropped resources still in use stay alive, and shared, until released.
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+void
+resource_cache::impl::evict ()
+{
+  while (bytes_ > budget_ && !lru_.empty ())
+    {
+      entry& e = lru_.back ()->second;
+
+      bytes_ -= e.bytes;
+      e.strong.reset ();
+      lru_.pop_back ();
+      statistics_.evictions++;
+    }
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Remove entries whose resources were freed
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+void
+resource_cache::impl::purge ()
+{
+  for (auto iter = entries_.begin (); iter != entries_.end (); )
+    {
+      if (iter->second.weak.expired ())
+        iter = entries_.erase (iter);
+
+      else
+        ++iter;
+    }
+
+  purge_size_ = std::max (std::size_t (64), 2 * entries_.size ());
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Set budget
+//! \param budget Maximum bytes kept alive by the LRU list
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+void
+resource_cache::impl::set_budget (std::size_t budget)
+{
+  std::lock_guard <std::mutex> lock (mutex_);
+
+  budget_ = budget;
+  evict ();
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Get budget
+//! \return Maximum bytes kept alive by the LRU list
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+std::size_t
+resource_cache::impl::get_budget () const
+{
+  std::lock_guard <std::mutex> lock (mutex_);
+  return budget_;
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Get counters
+//! \return Counters
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+resource_cache::statistics
+resource_cache::impl::get_statistics () const
+{
+  std::lock_guard <std::mutex> lock (mutex_);
+
+  statistics s = statistics_;
+  s.bytes = bytes_;
+  s.retained = lru_.size ();
+
+  return s;
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Reset hit, miss and eviction counters
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+void
+resource_cache::impl::reset_statistics ()
+{
+  std::lock_guard <std::mutex> lock (mutex_);
+  statistics_ = statistics ();
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Remove all entries
+//!
+//! Resources still in use stay alive, but are no longer shared.
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+void
+resource_cache::impl::clear ()
+{
+  std::lock_guard <std::mutex> lock (mutex_);
+
+  lru_.clear ();
+  entries_.clear ();
+  bytes_ = 0;
+  purge_size_ = 64;
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Constructor
+//! \param budget Maximum bytes kept alive by the LRU list
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+resource_cache::resource_cache (std::size_t budget)
+  : impl_ (std::make_shared <impl> (budget))
+{
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Get bitmap
+//! \param path Bitmap file path
+//! \param flags New bitmap flags used to load it
+//! \return Bitmap, shared with previous requests if possible
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+bitmap
+resource_cache::get_bitmap (const std::string& path, int flags)
+{
+  auto load = [&path, flags]
+  {
+    const int old_flags = al_get_new_bitmap_flags ();
+    al_set_new_bitmap_flags (flags);
+    bitmap b (path);
+    al_set_new_bitmap_flags (old_flags);
+
+    return b;
+  };
+
+  const std::string key = "bitmap\n" + std::to_string (flags) + '\n' + path;
+
+  return impl_->get <bitmap> (key, load, [](const bitmap& b){ return get_size (b); });
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Get font
+//! \param path Font path
+//! \param size Font size
+//! \param flags Font loading flags
+//! \return Font, shared with previous requests if possible
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+font
+resource_cache::get_font (const std::string& path, std::size_t size, int flags)
+{
+  const std::string key = "font\n" + std::to_string (size) + '\n' + std::to_string (flags) + '\n' + path;
+
+  return impl_->get <font> (key, [&]{ return font (path, size, flags); }, [&](const font&){ return get_file_size (path); });
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Get audio sample
+//! \param path Sample file path
+//! \return Sample, shared with previous requests if possible
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+sample
+resource_cache::get_sample (const std::string& path)
+{
+  const std::string key = "sample\n" + path;
+
+  return impl_->get <sample> (key, [&]{ return sample (path); }, [](const sample& s){ return get_size (s); });
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Set budget
+//! \param budget Maximum bytes kept alive by the LRU list
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+void
+resource_cache::set_budget (std::size_t budget)
+{
+  impl_->set_budget (budget);
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Get budget
+//! \return Maximum bytes kept alive by the LRU list
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+std::size_t
+resource_cache::get_budget () const
+{
+  return impl_->get_budget ();
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Get counters
+//! \return Counters
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+resource_cache::statistics
+resource_cache::get_statistics () const
+{
+  return impl_->get_statistics ();
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Reset hit, miss and eviction counters
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+void
+resource_cache::reset_statistics ()
+{
+  impl_->reset_statistics ();
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Remove all entries
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+void
+resource_cache::clear ()
+{
+  impl_->clear ();
+}
+
+} // namespace allegropp
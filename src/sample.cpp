@@ -77,6 +77,16 @@ public:
   // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
   void play (double, double, double, ALLEGRO_PLAYMODE);
 
+  // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+  //! \brief Get implementation object
+  //! \return Allegro sample
+  // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+  ALLEGRO_SAMPLE *
+  get_implementation () const noexcept
+  {
+    return obj_;
+  }
+
 private:
   //! \brief Allegro sample object
   ALLEGRO_SAMPLE *obj_ = nullptr;
@@ -135,6 +145,15 @@ sample::sample (const std::string& path)
 {
 }
 
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Constructor
+//! \param impl Implementation smart pointer
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+sample::sample (const std::shared_ptr <impl>& impl)
+  : impl_ (impl)
+{
+}
+
 // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
 //! \brief Operator bool
 //! \return true/false
@@ -180,4 +199,14 @@ sample::play_bidir (double gain, double pan, double speed)
   impl_->play (gain, pan, speed, ALLEGRO_PLAYMODE_BIDIR);
 }
 
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Get implementation object
+//! \return Allegro sample
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+ALLEGRO_SAMPLE *
+sample::get_implementation () const
+{
+  return impl_->get_implementation ();
+}
+
 } // namespace allegropp
@@ -0,0 +1,857 @@
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @author      Eduardo Aguiar <aguiar@protonmail.ch>
+// @copyright   Copyright (c) 2025 Eduardo Aguiar
+//
+// This file is part of Allegro++.
+// 
+// Allegro++ is free software: you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+// 
+// You should have received a copy of the GNU Lesser General Public License
+// along with Allegro++. If not, see <https://www.gnu.org/licenses/>.
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+#include <allegropp/sdf_font.hpp>
+#include <allegropp/bitmap_lock.hpp>
+#include <allegropp/font.hpp>
+#include "parallel_for.hpp"
+#include "utf8.hpp"
+#include <allegro5/allegro.h>
+#include <allegro5/allegro_font.h>
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstdint>
+#include <stdexcept>
+#include <unordered_map>
+#include <vector>
+
+namespace
+{
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// Constants
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+constexpr int PIXEL_FORMAT = ALLEGRO_PIXEL_FORMAT_ABGR_8888_LE;
+constexpr int PAGE_SIZE = 1024;
+constexpr float FAR = 1e20f;
+
+//! \brief Character sets up to this size get a kerning table
+constexpr std::size_t MAX_KERNED_GLYPHS = 256;
+
+//! \brief GLSL pixel shader, thresholding the distance field
+constexpr char PIXEL_SHADER_GLSL[] = R"(
+#ifdef GL_ES
+precision mediump float;
+#endif
+uniform sampler2D al_tex;
+uniform float sdf_smoothing;
+varying vec4 varying_color;
+varying vec2 varying_texcoord;
+
+void main ()
+{
+  float d = texture2D (al_tex, varying_texcoord).a;
+  gl_FragColor = varying_color * smoothstep (0.5 - sdf_smoothing, 0.5 + sdf_smoothing, d);
+}
+)";
+
+//! \brief HLSL pixel shader, thresholding the distance field
+constexpr char PIXEL_SHADER_HLSL[] = R"(
+texture al_tex;
+sampler2D s = sampler_state { texture = <al_tex>; };
+float sdf_smoothing;
+
+float4 ps_main (VS_OUTPUT Input) : COLOR0
+{
+  float d = tex2D (s, Input.TexCoord).a;
+  return Input.Color * smoothstep (0.5 - sdf_smoothing, 0.5 + sdf_smoothing, d);
+}
+)";
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Allegro state saved for the lifetime of the object (RAII)
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+class state_guard
+{
+public:
+  explicit state_guard (int flags) { al_store_state (&state_, flags); }
+  state_guard (const state_guard&) = delete;
+  ~state_guard () { al_restore_state (&state_); }
+  state_guard& operator= (const state_guard&) = delete;
+
+private:
+  ALLEGRO_STATE state_;
+};
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Squared Euclidean distance transform of a sampled function, 1D
+//! \param f Input samples, FAR where there is no feature
+//! \param d Output squared distances
+//! \param n Number of samples
+//! \param v Scratch, n ints
+//! \param z Scratch, n + 1 floats
+//!
+//! Felzenszwalb and Huttenlocher's lower envelope of parabolas, O(n).
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+void
+edt_1d (const float *f, float *d, int n, int *v, float *z)
+{
+  int k = 0;
+  v[0] = 0;
+  z[0] = -FAR;
+  z[1] = FAR;
+
+  for (int q = 1; q < n; q++)
+    {
+      float s;
+
+      for (;;)
+        {
+          const int r = v[k];
+          s = ((f[q] + float (q) * q) - (f[r] + float (r) * r)) / float (2 * q - 2 * r);
+
+          if (s > z[k] || k == 0)
+            break;
+
+          k--;
+        }
+
+      if (s <= z[k])
+        s = z[k];
+
+      k++;
+      v[k] = q;
+      z[k] = s;
+      z[k + 1] = FAR;
+    }
+
+  k = 0;
+
+  for (int q = 0; q < n; q++)
+    {
+      while (z[k + 1] < float (q))
+        k++;
+
+      const float dq = float (q - v[k]);
+      d[q] = dq * dq + f[v[k]];
+    }
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Squared Euclidean distance transform, 2D, in place
+//! \param grid Samples, row major, FAR where there is no feature
+//! \param width Grid width
+//! \param height Grid height
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+void
+edt_2d (std::vector <float>& grid, int width, int height)
+{
+  const int n = std::max (width, height);
+  std::vector <float> f (n), d (n), z (n + 1);
+  std::vector <int> v (n);
+
+  for (int x = 0; x < width; x++)
+    {
+      for (int y = 0; y < height; y++)
+        f[y] = grid[std::size_t (y) * width + x];
+
+      edt_1d (f.data (), d.data (), height, v.data (), z.data ());
+
+      for (int y = 0; y < height; y++)
+        grid[std::size_t (y) * width + x] = d[y];
+    }
+
+  for (int y = 0; y < height; y++)
+    {
+      float *row = grid.data () + std::size_t (y) * width;
+      std::copy (row, row + width, f.begin ());
+      edt_1d (f.data (), row, width, v.data (), z.data ());
+    }
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Make distance field from glyph coverage
+//! \param coverage Coverage (0..255), row major
+//! \param width Glyph width
+//! \param height Glyph height
+//! \param spread Distance mapped to the 0..1 range, in pixels
+//! \return Distance field, as white pixels whose alpha is 0.5 on the outline
+//!
+//! Pixels are inside when coverage >= 50%. Anti-aliased edge pixels use their
+//! coverage as a sub-pixel distance to the outline.
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+std::vector <std::uint32_t>
+make_distance_field (const std::vector <std::uint8_t>& coverage, int width, int height, int spread)
+{
+  const std::size_t size = coverage.size ();
+  std::vector <float> to_inside (size), to_outside (size);
+
+  for (std::size_t i = 0; i < size; i++)
+    {
+      const bool is_inside = coverage[i] >= 128;
+      to_inside[i] = is_inside ? 0.0f : FAR;
+      to_outside[i] = is_inside ? FAR : 0.0f;
+    }
+
+  edt_2d (to_inside, width, height);
+  edt_2d (to_outside, width, height);
+
+  std::vector <std::uint32_t> pixels (size);
+
+  for (std::size_t i = 0; i < size; i++)
+    {
+      float distance;   // to the outline, negative inside
+
+      if (coverage[i] > 0 && coverage[i] < 255)
+        distance = 0.5f - coverage[i] / 255.0f;
+
+      else if (coverage[i] >= 128)
+        distance = 0.5f - std::sqrt (to_outside[i]);
+
+      else
+        distance = std::sqrt (to_inside[i]) - 0.5f;
+
+      const float value = std::clamp (0.5f - distance / (2.0f * spread), 0.0f, 1.0f);
+      pixels[i] = (std::uint32_t (value * 255.0f + 0.5f) << 24) | 0x00ffffff;
+    }
+
+  return pixels;
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Get kerning table key
+//! \param cp Code point
+//! \param next Next code point
+//! \return Key
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+constexpr std::uint64_t
+get_pair_key (std::int32_t cp, std::int32_t next) noexcept
+{
+  return (std::uint64_t (std::uint32_t (cp)) << 32) | std::uint32_t (next);
+}
+
+} // namespace
+
+namespace allegropp
+{
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief <i>sdf_font</i> implementation class
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+class sdf_font::impl
+{
+public:
+  // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+  // Constructors and destructor
+  // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+  impl (const std::string&, std::string_view, int, int, unsigned int);
+  impl (const impl&) = delete;
+  impl (impl&&) = delete;
+  ~impl ();
+
+  // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+  // Operators
+  // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+  impl& operator= (const impl&) = delete;
+  impl& operator= (impl&&) = delete;
+
+  // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+  // Prototypes
+  // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+  float get_text_width (float, std::string_view) const;
+  void draw_text (float, float, float, std::string_view, const color&, int);
+
+  // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+  //! \brief Get base size
+  //! \return Size glyphs were rasterized at
+  // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+  int
+  get_base_size () const noexcept
+  {
+    return size_;
+  }
+
+  // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+  //! \brief Get spread
+  //! \return Distance field spread, in base size pixels
+  // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+  int
+  get_spread () const noexcept
+  {
+    return spread_;
+  }
+
+  // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+  //! \brief Get number of glyphs
+  //! \return Number of glyphs
+  // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+  std::size_t
+  get_glyph_count () const noexcept
+  {
+    return glyphs_.size ();
+  }
+
+  // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+  //! \brief Get atlas
+  //! \return Distance field atlas
+  // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+  const atlas&
+  get_atlas () const noexcept
+  {
+    return atlas_;
+  }
+
+  // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+  //! \brief Get base size metrics
+  // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+  int get_font_line_height () const noexcept { return line_height_; }
+  int get_font_ascent () const noexcept { return ascent_; }
+  int get_font_descent () const noexcept { return descent_; }
+
+private:
+  //! \brief Glyph, at base size
+  struct glyph
+  {
+    std::int32_t cp = 0;                //!< Code point
+    int advance = 0;                    //!< Advance, without kerning
+    int offset_x = 0;                   //!< Image left, relative to the pen
+    int offset_y = 0;                   //!< Image top, relative to the line top
+    bool has_image = false;             //!< Glyph is not blank
+    sprite image;                       //!< Distance field
+  };
+
+  const glyph *find_glyph (std::int32_t) const;
+  int get_kerning (std::int32_t, std::int32_t) const;
+  void create_shader ();
+
+  int size_;                                            //!< Base size
+  int spread_;                                          //!< Distance field spread
+  int line_height_ = 0;                                 //!< Line height at base size
+  int ascent_ = 0;                                      //!< Ascent at base size
+  int descent_ = 0;                                     //!< Descent at base size
+  std::vector <glyph> glyphs_;                          //!< Glyphs
+  std::unordered_map <std::int32_t, std::size_t> index_;        //!< Glyphs by code point
+  std::array <int, 128> ascii_;                         //!< ASCII glyph indexes, or -1
+  std::unordered_map <std::uint64_t, int> kerning_;     //!< Non-zero kerning by pair
+  const glyph *fallback_ = nullptr;                     //!< Glyph for missing code points
+  atlas atlas_;                                         //!< Distance field atlas
+  ALLEGRO_SHADER *shader_ = nullptr;                    //!< Thresholding shader
+};
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Constructor
+//! \param path Font path
+//! \param charset UTF-8 characters to load (empty for printable ASCII)
+//! \param size Base size, in pixels
+//! \param spread Distance field spread, in base size pixels
+//! \param threads Worker threads, including the calling one
+//!
+//! Glyphs are rasterized on the calling thread, as Allegro fonts are not
+//! thread safe, into memory bitmaps. Distance fields are computed, and the
+//! atlas composed, on worker threads.
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+sdf_font::impl::impl (const std::string& path, std::string_view charset, int size, int spread, unsigned int threads)
+  : size_ (size),
+    spread_ (spread),
+    atlas_ (PAGE_SIZE, PAGE_SIZE, 1, 1, threads)
+{
+  if (size < 1)
+    throw std::invalid_argument ("invalid SDF font size");
+
+  if (spread < 1)
+    throw std::invalid_argument ("invalid SDF font spread");
+
+  if (threads < 1)
+    throw std::invalid_argument ("invalid SDF font thread count");
+
+  // Decode character set
+  std::vector <std::int32_t> cps;
+
+  if (charset.empty ())
+    for (std::int32_t cp = ' '; cp <= '~'; cp++)
+      cps.push_back (cp);
+
+  else
+    for (std::size_t pos = 0; pos < charset.size ();)
+      cps.push_back (decode_utf8 (charset, pos));
+
+  std::sort (cps.begin (), cps.end ());
+  cps.erase (std::unique (cps.begin (), cps.end ()), cps.end ());
+
+  // Load font with memory glyph caches, as glyphs are read back
+  state_guard guard (ALLEGRO_STATE_NEW_BITMAP_PARAMETERS | ALLEGRO_STATE_TARGET_BITMAP | ALLEGRO_STATE_BLENDER);
+  const int flags = al_get_new_bitmap_flags ();
+  al_set_new_bitmap_flags (ALLEGRO_MEMORY_BITMAP);
+
+  font f (path, std::size_t (size));
+
+  if (!f)
+    throw std::runtime_error ("cannot load font: " + path);
+
+  ALLEGRO_FONT *obj = f.get_implementation ();
+  line_height_ = al_get_font_line_height (obj);
+  ascent_ = al_get_font_ascent (obj);
+  descent_ = al_get_font_descent (obj);
+
+  // Get glyph metrics
+  struct raster
+  {
+    int width = 0;
+    int height = 0;
+    std::vector <std::uint8_t> coverage;
+    std::vector <std::uint32_t> pixels;
+  };
+
+  std::vector <raster> rasters;
+  std::vector <int> bbox_x, bbox_y;
+  int max_width = 1;
+  int max_height = 1;
+
+  for (std::int32_t cp : cps)
+    {
+      int bbx, bby, bbw, bbh;
+
+      if (!al_get_glyph_dimensions (obj, cp, &bbx, &bby, &bbw, &bbh))
+        continue;
+
+      glyph g;
+      g.cp = cp;
+      g.advance = al_get_glyph_advance (obj, cp, ALLEGRO_NO_KERNING);
+      g.offset_x = bbx - spread;
+      g.offset_y = bby - spread;
+      g.has_image = bbw > 0 && bbh > 0;
+
+      raster r;
+
+      if (g.has_image)
+        {
+          r.width = bbw + 2 * spread;
+          r.height = bbh + 2 * spread;
+          max_width = std::max (max_width, r.width);
+          max_height = std::max (max_height, r.height);
+        }
+
+      glyphs_.push_back (std::move (g));
+      rasters.push_back (std::move (r));
+      bbox_x.push_back (bbx);
+      bbox_y.push_back (bby);
+    }
+
+  // Rasterize glyphs, in white, keeping their coverage
+  bitmap scratch (max_width, max_height);
+
+  if (!scratch)
+    throw std::runtime_error ("cannot create SDF font scratch bitmap");
+
+  al_set_target_bitmap (scratch.get_implementation ());
+  al_set_blender (ALLEGRO_ADD, ALLEGRO_ONE, ALLEGRO_INVERSE_ALPHA);
+
+  for (std::size_t i = 0; i < glyphs_.size (); i++)
+    {
+      raster& r = rasters[i];
+
+      if (!glyphs_[i].has_image)
+        continue;
+
+      al_clear_to_color (al_map_rgba (0, 0, 0, 0));
+      al_draw_glyph (obj, al_map_rgb (255, 255, 255), float (spread - bbox_x[i]), float (spread - bbox_y[i]), glyphs_[i].cp);
+
+      auto lock = scratch.lock (0, 0, r.width, r.height, PIXEL_FORMAT, bitmap::READ_ONLY);
+      auto src = lock.get_span <const std::uint32_t> ();
+      r.coverage.resize (std::size_t (r.width) * r.height);
+
+      for (int y = 0; y < r.height; y++)
+        for (int x = 0; x < r.width; x++)
+          r.coverage[std::size_t (y) * r.width + x] = std::uint8_t (src (x, y) >> 24);
+    }
+
+  // Compute distance fields
+  parallel_for (threads, rasters.size (), [&](std::size_t i)
+  {
+    raster& r = rasters[i];
+
+    if (!r.coverage.empty ())
+      {
+        r.pixels = make_distance_field (r.coverage, r.width, r.height, spread);
+        r.coverage = std::vector <std::uint8_t> ();
+      }
+  });
+
+  // Pack distance fields into the atlas, with linear filtering
+  for (std::size_t i = 0; i < glyphs_.size (); i++)
+    {
+      raster& r = rasters[i];
+
+      if (!glyphs_[i].has_image)
+        continue;
+
+      bitmap b (r.width, r.height);
+
+      if (!b)
+        throw std::runtime_error ("cannot create SDF glyph bitmap");
+
+      auto lock = b.lock (PIXEL_FORMAT, bitmap::WRITE_ONLY);
+      copy (pixel_span <const std::uint32_t> (r.pixels.data (), r.width, r.height, r.width * 4),
+            lock.get_span <std::uint32_t> ());
+      lock.unlock ();
+
+      atlas_.add (std::to_string (glyphs_[i].cp), b);
+      r.pixels = std::vector <std::uint32_t> ();
+    }
+
+  al_set_new_bitmap_flags ((flags & ~ALLEGRO_MEMORY_BITMAP) | ALLEGRO_MIN_LINEAR | ALLEGRO_MAG_LINEAR);
+  atlas_.build ();
+
+  // Index glyphs
+  ascii_.fill (-1);
+
+  for (std::size_t i = 0; i < glyphs_.size (); i++)
+    {
+      glyph& g = glyphs_[i];
+
+      if (g.has_image)
+        g.image = atlas_.get_sprite (std::to_string (g.cp));
+
+      index_[g.cp] = i;
+
+      if (g.cp < 128)
+        ascii_[g.cp] = int (i);
+    }
+
+  fallback_ = find_glyph ('?');
+
+  // Kerning table, for small character sets
+  if (glyphs_.size () <= MAX_KERNED_GLYPHS)
+    for (const auto& a : glyphs_)
+      for (const auto& b : glyphs_)
+        {
+          const int k = al_get_glyph_advance (obj, a.cp, b.cp) - a.advance;
+
+          if (k)
+            kerning_[get_pair_key (a.cp, b.cp)] = k;
+        }
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Destructor
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+sdf_font::impl::~impl ()
+{
+  if (shader_)
+    al_destroy_shader (shader_);
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Get text width
+//! \param size Font size, in pixels
+//! \param text UTF-8 text
+//! \return Width in pixels
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+float
+sdf_font::impl::get_text_width (float size, std::string_view text) const
+{
+  int width = 0;
+  std::int32_t prev = -1;
+
+  for (std::size_t pos = 0; pos < text.size ();)
+    {
+      const glyph *g = find_glyph (decode_utf8 (text, pos));
+
+      if (!g)
+        continue;
+
+      width += get_kerning (prev, g->cp) + g->advance;
+      prev = g->cp;
+    }
+
+  return float (width) * size / float (size_);
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Draw text
+//! \param size Font size, in pixels
+//! \param x X pos
+//! \param y Top Y pos
+//! \param text UTF-8 text
+//! \param c Color object
+//! \param align ALLEGRO_ALIGN_LEFT, ALLEGRO_ALIGN_CENTER or ALLEGRO_ALIGN_RIGHT
+//!
+//! Glyphs are drawn with held bitmap drawing, between shader switches, so
+//! a line of text is a single draw call per atlas page.
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+void
+sdf_font::impl::draw_text (float size, float x, float y, std::string_view text, const color& c, int align)
+{
+  if (text.empty ())
+    return;
+
+  if (!shader_)
+    create_shader ();
+
+  const float scale = size / float (size_);
+
+  if (align == ALLEGRO_ALIGN_CENTER)
+    x -= get_text_width (size, text) * 0.5f;
+
+  else if (align == ALLEGRO_ALIGN_RIGHT)
+    x -= get_text_width (size, text);
+
+  // Held drawing must be flushed before the shader changes
+  const bool is_held = al_is_bitmap_drawing_held ();
+
+  if (is_held)
+    al_hold_bitmap_drawing (false);
+
+  ALLEGRO_SHADER *previous = al_get_current_shader ();
+  al_use_shader (shader_);
+
+  // Smooth edges over about one destination pixel
+  const float smoothing = std::min (0.25f / (float (spread_) * scale), 0.5f);
+  al_set_shader_float ("sdf_smoothing", smoothing);
+
+  al_hold_bitmap_drawing (true);
+
+  const ALLEGRO_COLOR tint = c.get_implementation ();
+  int pen = 0;
+  std::int32_t prev = -1;
+
+  for (std::size_t pos = 0; pos < text.size ();)
+    {
+      const glyph *g = find_glyph (decode_utf8 (text, pos));
+
+      if (!g)
+        continue;
+
+      pen += get_kerning (prev, g->cp);
+      prev = g->cp;
+
+      if (g->has_image)
+        {
+          const sprite& s = g->image;
+
+          al_draw_tinted_scaled_bitmap (
+            s.get_bitmap ().get_implementation (), tint,
+            0, 0, float (s.get_width ()), float (s.get_height ()),
+            x + float (pen + g->offset_x) * scale,
+            y + float (g->offset_y) * scale,
+            float (s.get_width ()) * scale,
+            float (s.get_height ()) * scale,
+            0
+          );
+        }
+
+      pen += g->advance;
+    }
+
+  al_hold_bitmap_drawing (false);
+  al_use_shader (previous);
+
+  if (is_held)
+    al_hold_bitmap_drawing (true);
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Find glyph
+//! \param cp Code point
+//! \return Glyph, fallback glyph, or nullptr
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+const sdf_font::impl::glyph *
+sdf_font::impl::find_glyph (std::int32_t cp) const
+{
+  if (cp >= 0 && cp < 128)
+    return ascii_[cp] >= 0 ? &glyphs_[ascii_[cp]] : fallback_;
+
+  auto iter = index_.find (cp);
+
+  return iter != index_.end () ? &glyphs_[iter->second] : fallback_;
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Get kerning between two glyphs
+//! \param prev Previous code point, or -1
+//! \param cp Code point
+//! \return Kerning, at base size
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+int
+sdf_font::impl::get_kerning (std::int32_t prev, std::int32_t cp) const
+{
+  if (prev < 0 || kerning_.empty ())
+    return 0;
+
+  auto iter = kerning_.find (get_pair_key (prev, cp));
+
+  return iter != kerning_.end () ? iter->second : 0;
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Create thresholding shader, for the current display
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+void
+sdf_font::impl::create_shader ()
+{
+  ALLEGRO_SHADER *shader = al_create_shader (ALLEGRO_SHADER_AUTO);
+
+  if (!shader)
+    throw std::runtime_error ("cannot create SDF font shader (display needs ALLEGRO_PROGRAMMABLE_PIPELINE)");
+
+  const ALLEGRO_SHADER_PLATFORM platform = al_get_shader_platform (shader);
+  const char *pixel_shader = platform == ALLEGRO_SHADER_HLSL ? PIXEL_SHADER_HLSL : PIXEL_SHADER_GLSL;
+
+  if (!al_attach_shader_source (shader, ALLEGRO_VERTEX_SHADER, al_get_default_shader_source (platform, ALLEGRO_VERTEX_SHADER)) ||
+      !al_attach_shader_source (shader, ALLEGRO_PIXEL_SHADER, pixel_shader) ||
+      !al_build_shader (shader))
+    {
+      const std::string log = al_get_shader_log (shader);
+      al_destroy_shader (shader);
+      throw std::runtime_error ("cannot build SDF font shader: " + log);
+    }
+
+  shader_ = shader;
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Constructor
+//! \param path Font path
+//! \param charset UTF-8 characters to load (empty for printable ASCII)
+//! \param size Base size, in pixels
+//! \param spread Distance field spread, in base size pixels
+//! \param threads Worker threads, including the calling one
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+sdf_font::sdf_font (const std::string& path, std::string_view charset, int size, int spread, unsigned int threads)
+  : impl_ (std::make_shared <impl> (path, charset, size, spread, threads))
+{
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Get base size
+//! \return Size glyphs were rasterized at, in pixels
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+int
+sdf_font::get_base_size () const
+{
+  return impl_->get_base_size ();
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Get spread
+//! \return Distance field spread, in base size pixels
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+int
+sdf_font::get_spread () const
+{
+  return impl_->get_spread ();
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Get number of glyphs
+//! \return Number of glyphs
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+std::size_t
+sdf_font::get_glyph_count () const
+{
+  return impl_->get_glyph_count ();
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Get atlas
+//! \return Distance field atlas
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+const atlas&
+sdf_font::get_atlas () const
+{
+  return impl_->get_atlas ();
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Get font line height
+//! \param size Font size, in pixels
+//! \return Height in pixels
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+float
+sdf_font::get_font_line_height (float size) const
+{
+  return float (impl_->get_font_line_height ()) * size / float (impl_->get_base_size ());
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Get font ascent
+//! \param size Font size, in pixels
+//! \return Font ascent in pixels
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+float
+sdf_font::get_font_ascent (float size) const
+{
+  return float (impl_->get_font_ascent ()) * size / float (impl_->get_base_size ());
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Get font descent
+//! \param size Font size, in pixels
+//! \return Font descent in pixels
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+float
+sdf_font::get_font_descent (float size) const
+{
+  return float (impl_->get_font_descent ()) * size / float (impl_->get_base_size ());
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Get text width
+//! \param size Font size, in pixels
+//! \param text UTF-8 text
+//! \return Text width in pixels
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+float
+sdf_font::get_text_width (float size, std::string_view text) const
+{
+  return impl_->get_text_width (size, text);
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Draw text at left position
+//! \param size Font size, in pixels
+//! \param x X pos
+//! \param y Y pos
+//! \param text UTF-8 text
+//! \param c Color object
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+void
+sdf_font::draw_text_left (float size, float x, float y, std::string_view text, const color& c) const
+{
+  impl_->draw_text (size, x, y, text, c, ALLEGRO_ALIGN_LEFT);
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Draw text at center position
+//! \param size Font size, in pixels
+//! \param x X pos
+//! \param y Y pos
+//! \param text UTF-8 text
+//! \param c Color object
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+void
+sdf_font::draw_text_center (float size, float x, float y, std::string_view text, const color& c) const
+{
+  impl_->draw_text (size, x, y, text, c, ALLEGRO_ALIGN_CENTER);
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Draw text at right position
+//! \param size Font size, in pixels
+//! \param x X pos
+//! \param y Y pos
+//! \param text UTF-8 text
+//! \param c Color object
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+void
+sdf_font::draw_text_right (float size, float x, float y, std::string_view text, const color& c) const
+{
+  impl_->draw_text (size, x, y, text, c, ALLEGRO_ALIGN_RIGHT);
+}
+
+} // namespace allegropp
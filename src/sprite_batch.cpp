@@ -0,0 +1,204 @@
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @author      Eduardo Aguiar <aguiar@protonmail.ch>
+// @copyright   Copyright (c) 2025 Eduardo Aguiar
+//
+// This file is part of Allegro++.
+// 
+// Allegro++ is free software: you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+// 
+// You should have received a copy of the GNU Lesser General Public License
+// along with Allegro++. If not, see <https://www.gnu.org/licenses/>.
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+#include <allegropp/sprite_batch.hpp>
+#include <algorithm>
+#include <functional>
+#include <stdexcept>
+
+namespace
+{
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Get bitmap owning the texture of a bitmap
+//! \param bitmap Allegro bitmap, possibly a sub-bitmap
+//! \return Parent bitmap, or bitmap itself
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+ALLEGRO_BITMAP *
+get_texture (ALLEGRO_BITMAP *bitmap)
+{
+  ALLEGRO_BITMAP *parent = bitmap ? al_get_parent_bitmap (bitmap) : nullptr;
+  return parent ? parent : bitmap;
+}
+
+} // namespace
+
+namespace allegropp
+{
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Constructor
+//! \param mode Sort mode
+//! \param capacity Number of draws to reserve room for
+//!
+//! Holds bitmap drawing until the batch ends.
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+sprite_batch::sprite_batch (sort_mode mode, std::size_t capacity)
+  : sort_mode_ (mode),
+    was_held_ (al_is_bitmap_drawing_held ())
+{
+  if (mode > SUBMISSION)
+    throw std::invalid_argument ("invalid sprite batch sort mode");
+
+  entries_.reserve (capacity);
+  al_hold_bitmap_drawing (true);
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Destructor. Ends the batch, if not ended yet
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+sprite_batch::~sprite_batch ()
+{
+  if (is_active_)
+    end ();
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Record bitmap draw
+//! \param b Bitmap or sub-bitmap
+//! \param x Left X pos
+//! \param y Top Y pos
+//! \param layer Layer
+//! \param flags Flip flags
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+void
+sprite_batch::draw (const bitmap& b, float x, float y, int layer, int flags)
+{
+  ALLEGRO_BITMAP *obj = b.get_implementation ();
+
+  if (!obj)
+    throw std::invalid_argument ("null bitmap object");
+
+  record (obj, get_texture (obj), 0, 0, x, y, WHITE, 0, 1, 1, layer, flags);
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Record tinted, rotated and scaled bitmap draw
+//! \param b Bitmap or sub-bitmap
+//! \param x Center X pos
+//! \param y Center Y pos
+//! \param tint Tint color
+//! \param angle Clockwise rotation around the center, in radians
+//! \param scale_x Horizontal scale
+//! \param scale_y Vertical scale
+//! \param layer Layer
+//! \param flags Flip flags
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+void
+sprite_batch::draw (const bitmap& b, float x, float y, const color& tint, float angle, float scale_x, float scale_y, int layer, int flags)
+{
+  ALLEGRO_BITMAP *obj = b.get_implementation ();
+
+  if (!obj)
+    throw std::invalid_argument ("null bitmap object");
+
+  record (obj, get_texture (obj), al_get_bitmap_width (obj) * 0.5f, al_get_bitmap_height (obj) * 0.5f,
+          x, y, tint.get_implementation (), angle, scale_x, scale_y, layer, flags);
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Draw recorded sprites now
+//!
+//! Useful before drawing something else (primitives, text) that must go
+//! over the sprites recorded so far.
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+void
+sprite_batch::flush ()
+{
+  if (entries_.empty ())
+    return;
+
+  if (sort_mode_ == SORTED)
+    {
+      auto less = [](const entry& a, const entry& b)
+      {
+        // Textures are unrelated pointers, which only std::less orders
+        return a.layer < b.layer ||
+               (a.layer == b.layer && std::less <const ALLEGRO_BITMAP *> () (a.texture, b.texture));
+      };
+
+      if (!std::is_sorted (entries_.begin (), entries_.end (), less))
+        std::stable_sort (entries_.begin (), entries_.end (), less);
+    }
+
+  // Each run of the same texture is one draw call. A run continuing the
+  // texture of the previous flush is a new call, but not a switch
+  ALLEGRO_BITMAP *texture = nullptr;
+
+  for (const auto& e : entries_)
+    {
+      if (e.texture != texture || &e == &entries_.front ())
+        {
+          statistics_.draw_calls++;
+
+          if (e.texture != last_texture_)
+            statistics_.texture_switches++;
+
+          texture = last_texture_ = e.texture;
+        }
+
+      al_draw_tinted_scaled_rotated_bitmap (e.bitmap, e.tint, e.cx, e.cy, e.x, e.y, e.scale_x, e.scale_y, e.angle, e.flags);
+    }
+
+  statistics_.sprites += entries_.size ();
+  entries_.clear ();
+
+  // Release held vertices to the GPU
+  al_hold_bitmap_drawing (false);
+  al_hold_bitmap_drawing (true);
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief End batch, drawing recorded sprites
+//! \return Counters for the whole batch
+//!
+//! Drawing stays held if it was already held when the batch began.
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+sprite_batch::statistics
+sprite_batch::end ()
+{
+  if (!is_active_)
+    return statistics_;
+
+  flush ();
+  is_active_ = false;
+  al_hold_bitmap_drawing (was_held_);
+
+  return statistics_;
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Get counters
+//! \return Counters for the sprites flushed so far
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+const sprite_batch::statistics&
+sprite_batch::get_statistics () const noexcept
+{
+  return statistics_;
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Get sort mode
+//! \return Sort mode
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+sprite_batch::sort_mode
+sprite_batch::get_sort_mode () const noexcept
+{
+  return sort_mode_;
+}
+
+} // namespace allegropp
@@ -0,0 +1,403 @@
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @author      Eduardo Aguiar <aguiar@protonmail.ch>
+// @copyright   Copyright (c) 2025 Eduardo Aguiar
+//
+// This file is part of Allegro++.
+// 
+// Allegro++ is free software: you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+// 
+// You should have received a copy of the GNU Lesser General Public License
+// along with Allegro++. If not, see <https://www.gnu.org/licenses/>.
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+#include <allegropp/text_cache.hpp>
+#include <allegropp/bitmap.hpp>
+#include <allegro5/allegro.h>
+#include <allegro5/allegro_font.h>
+#include <algorithm>
+#include <functional>
+#include <list>
+#include <stdexcept>
+#include <string>
+#include <unordered_map>
+
+namespace allegropp
+{
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief <i>text_cache</i> implementation class
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+class text_cache::impl
+{
+public:
+  // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+  // Constructors
+  // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+  impl (std::size_t, std::size_t);
+  impl (const impl&) = delete;
+  impl (impl&&) = delete;
+
+  // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+  // Operators
+  // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+  impl& operator= (const impl&) = delete;
+  impl& operator= (impl&&) = delete;
+
+  // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+  // Prototypes
+  // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+  int get_text_width (const font&, std::string_view);
+  void draw_text (const font&, int, int, std::string_view, const color&, int);
+  statistics get_statistics () const;
+  void reset_statistics ();
+  void clear ();
+
+private:
+  //! \brief Cached text
+  struct entry
+  {
+    font owner;                         //!< Font, kept alive while cached
+    ALLEGRO_FONT *obj = nullptr;        //!< Allegro font
+    std::size_t hash = 0;               //!< Key hash
+    std::string text;                   //!< Text
+    int width = 0;                      //!< Text width
+    bitmap image;                       //!< Rendered text, if is_rendered
+    bool is_rendered = false;           //!< Text has been rendered
+    int offset_x = 0;                   //!< Image left, relative to the pen
+    int offset_y = 0;                   //!< Image top, relative to the pen
+    std::size_t bytes = 0;              //!< Image size
+  };
+
+  using lru_type = std::list <entry>;
+
+  entry& find (const font&, std::string_view, bool);
+  void render (entry&);
+  void evict ();
+
+  lru_type lru_;                                                //!< Entries, most recent first
+  std::unordered_multimap <std::size_t, lru_type::iterator> index_;     //!< Entries by key hash
+  std::size_t max_entries_;                                     //!< Maximum number of entries
+  std::size_t budget_;                                          //!< Maximum image bytes
+  std::size_t bytes_ = 0;                                       //!< Image bytes
+  statistics statistics_;                                       //!< Counters
+};
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Constructor
+//! \param max_entries Maximum number of entries
+//! \param budget Maximum bytes of rendered text bitmaps
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+text_cache::impl::impl (std::size_t max_entries, std::size_t budget)
+  : max_entries_ (max_entries),
+    budget_ (budget)
+{
+  if (max_entries < 1)
+    throw std::invalid_argument ("invalid text cache size");
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Get text width
+//! \param f Font
+//! \param text UTF-8 text
+//! \return Width in pixels
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+int
+text_cache::impl::get_text_width (const font& f, std::string_view text)
+{
+  return find (f, text, false).width;
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Draw text
+//! \param f Font
+//! \param x X pos
+//! \param y Y pos
+//! \param text UTF-8 text
+//! \param c Color
+//! \param align ALLEGRO_ALIGN_LEFT, ALLEGRO_ALIGN_CENTER or ALLEGRO_ALIGN_RIGHT
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+void
+text_cache::impl::draw_text (const font& f, int x, int y, std::string_view text, const color& c, int align)
+{
+  if (text.empty ())
+    return;
+
+  const entry& e = find (f, text, true);
+
+  if (align == ALLEGRO_ALIGN_CENTER)
+    x -= e.width / 2;
+
+  else if (align == ALLEGRO_ALIGN_RIGHT)
+    x -= e.width;
+
+  al_draw_tinted_bitmap (e.image.get_implementation (), c.get_implementation (), float (x + e.offset_x), float (y + e.offset_y), 0);
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Find entry, creating it on a miss
+//! \param f Font
+//! \param text UTF-8 text
+//! \param needs_image Entry must have its text rendered
+//! \return Entry, moved to the front of the LRU list
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+text_cache::impl::entry&
+text_cache::impl::find (const font& f, std::string_view text, bool needs_image)
+{
+  ALLEGRO_FONT *obj = f.get_implementation ();
+
+  if (!obj)
+    throw std::invalid_argument ("null font object");
+
+  const std::size_t hash = std::hash <std::string_view> () (text) ^ (std::hash <const void *> () (obj) * 0x9e3779b97f4a7c15ULL);
+
+  // Look up entry
+  auto range = index_.equal_range (hash);
+  auto iter = std::find_if (range.first, range.second, [&](const auto& item)
+  {
+    return item.second->obj == obj && item.second->text == text;
+  });
+
+  lru_type::iterator e;
+
+  if (iter != range.second)
+    {
+      e = iter->second;
+      lru_.splice (lru_.begin (), lru_, e);
+    }
+
+  else
+    {
+      lru_.emplace_front ();
+      e = lru_.begin ();
+      e->owner = f;
+      e->obj = obj;
+      e->hash = hash;
+      e->text = text;
+      e->width = al_get_text_width (obj, e->text.c_str ());
+      index_.emplace (hash, e);
+    }
+
+  // Count hit or miss, rendering text if needed
+  if (iter != range.second && (e->is_rendered || !needs_image))
+    statistics_.hits++;
+
+  else
+    {
+      statistics_.misses++;
+
+      if (needs_image)
+        render (*e);
+
+      evict ();
+    }
+
+  return *e;
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Render entry text into a bitmap, in white
+//! \param e Entry
+//!
+//! The bitmap covers the text bounding box and the line box, so glyphs
+//! overhanging the pen position (italics, accents) are not clipped.
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+void
+text_cache::impl::render (entry& e)
+{
+  int bbx, bby, bbw, bbh;
+  al_get_text_dimensions (e.obj, e.text.c_str (), &bbx, &bby, &bbw, &bbh);
+
+  const int left = std::min (0, bbx);
+  const int top = std::min (0, bby);
+  const int right = std::max (e.width, bbx + bbw);
+  const int bottom = std::max (al_get_font_line_height (e.obj), bby + bbh);
+
+  bitmap image (std::size_t (right - left), std::size_t (bottom - top));
+
+  if (!image)
+    throw std::runtime_error ("cannot create text bitmap");
+
+  // Held drawing must be flushed before switching targets
+  const bool is_held = al_is_bitmap_drawing_held ();
+
+  if (is_held)
+    al_hold_bitmap_drawing (false);
+
+  ALLEGRO_STATE state;
+  al_store_state (&state, ALLEGRO_STATE_TARGET_BITMAP | ALLEGRO_STATE_BLENDER);
+
+  al_set_target_bitmap (image.get_implementation ());
+  al_set_blender (ALLEGRO_ADD, ALLEGRO_ONE, ALLEGRO_INVERSE_ALPHA);
+  al_clear_to_color (al_map_rgba (0, 0, 0, 0));
+  al_draw_text (e.obj, al_map_rgb (255, 255, 255), float (-left), float (-top), ALLEGRO_ALIGN_LEFT, e.text.c_str ());
+
+  al_restore_state (&state);
+
+  if (is_held)
+    al_hold_bitmap_drawing (true);
+
+  e.image = image;
+  e.is_rendered = true;
+  e.offset_x = left;
+  e.offset_y = top;
+  e.bytes = std::size_t (right - left) * std::size_t (bottom - top) * 4;
+  bytes_ += e.bytes;
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Evict least recently used entries, keeping the most recent one
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+void
+text_cache::impl::evict ()
+{
+  while (lru_.size () > 1 && (lru_.size () > max_entries_ || bytes_ > budget_))
+    {
+      auto e = std::prev (lru_.end ());
+      auto range = index_.equal_range (e->hash);
+
+      for (auto iter = range.first; iter != range.second; ++iter)
+        if (iter->second == e)
+          {
+            index_.erase (iter);
+            break;
+          }
+
+      bytes_ -= e->bytes;
+      lru_.erase (e);
+      statistics_.evictions++;
+    }
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Get counters
+//! \return Counters
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+text_cache::statistics
+text_cache::impl::get_statistics () const
+{
+  statistics s = statistics_;
+  s.entries = lru_.size ();
+  s.bytes = bytes_;
+
+  return s;
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Reset hit, miss and eviction counters
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+void
+text_cache::impl::reset_statistics ()
+{
+  statistics_ = statistics ();
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Remove all entries
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+void
+text_cache::impl::clear ()
+{
+  index_.clear ();
+  lru_.clear ();
+  bytes_ = 0;
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Constructor
+//! \param max_entries Maximum number of entries
+//! \param budget Maximum bytes of rendered text bitmaps
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+text_cache::text_cache (std::size_t max_entries, std::size_t budget)
+  : impl_ (std::make_shared <impl> (max_entries, budget))
+{
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Get text width
+//! \param f Font
+//! \param text UTF-8 text
+//! \return Width in pixels
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+int
+text_cache::get_text_width (const font& f, std::string_view text)
+{
+  return impl_->get_text_width (f, text);
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Draw text at left position
+//! \param f Font
+//! \param x X pos
+//! \param y Y pos
+//! \param text UTF-8 text
+//! \param c Color object
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+void
+text_cache::draw_text_left (const font& f, int x, int y, std::string_view text, const color& c)
+{
+  impl_->draw_text (f, x, y, text, c, ALLEGRO_ALIGN_LEFT);
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Draw text at center position
+//! \param f Font
+//! \param x X pos
+//! \param y Y pos
+//! \param text UTF-8 text
+//! \param c Color object
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+void
+text_cache::draw_text_center (const font& f, int x, int y, std::string_view text, const color& c)
+{
+  impl_->draw_text (f, x, y, text, c, ALLEGRO_ALIGN_CENTER);
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Draw text at right position
+//! \param f Font
+//! \param x X pos
+//! \param y Y pos
+//! \param text UTF-8 text
+//! \param c Color object
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+void
+text_cache::draw_text_right (const font& f, int x, int y, std::string_view text, const color& c)
+{
+  impl_->draw_text (f, x, y, text, c, ALLEGRO_ALIGN_RIGHT);
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Get counters
+//! \return Counters
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+text_cache::statistics
+text_cache::get_statistics () const
+{
+  return impl_->get_statistics ();
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Reset hit, miss and eviction counters
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+void
+text_cache::reset_statistics ()
+{
+  impl_->reset_statistics ();
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Remove all entries
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+void
+text_cache::clear ()
+{
+  impl_->clear ();
+}
+
+} // namespace allegropp
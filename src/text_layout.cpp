@@ -0,0 +1,801 @@
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @author      Eduardo Aguiar <aguiar@protonmail.ch>
+// @copyright   Copyright (c) 2025 Eduardo Aguiar
+//
+// This file is part of Allegro++.
+// 
+// Allegro++ is free software: you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+// 
+// You should have received a copy of the GNU Lesser General Public License
+// along with Allegro++. If not, see <https://www.gnu.org/licenses/>.
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+#include <allegropp/text_layout.hpp>
+#include "utf8.hpp"
+#include <allegro5/allegro.h>
+#include <allegro5/allegro_font.h>
+#include <algorithm>
+#include <limits>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace
+{
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Check if code point is a line breaking space
+//! \param cp Code point
+//! \return true/false
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+constexpr bool
+is_space (std::int32_t cp) noexcept
+{
+  return cp == ' ' || cp == '\t';
+}
+
+//! \brief Ellipsis appended to truncated lines
+constexpr char ELLIPSIS[] = "...";
+
+} // namespace
+
+namespace allegropp
+{
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief <i>text_layout</i> implementation class
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+class text_layout::impl
+{
+public:
+  // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+  // Constructors
+  // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+  impl (const font&, std::string_view, int, alignment);
+  impl (const impl&) = delete;
+  impl (impl&&) = delete;
+
+  // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+  // Operators
+  // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+  impl& operator= (const impl&) = delete;
+  impl& operator= (impl&&) = delete;
+
+  // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+  // Prototypes
+  // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+  void set_font (const font&);
+  void set_text (std::string_view);
+  void append_text (std::string_view);
+  void set_width (int);
+  void set_alignment (alignment);
+  void set_max_lines (std::size_t);
+  std::size_t get_line_count ();
+  line get_line (std::size_t);
+  void draw (int, int, const color&, int, int);
+
+  // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+  //! \brief Get font
+  //! \return Font
+  // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+  font
+  get_font () const
+  {
+    return font_;
+  }
+
+  // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+  //! \brief Get text
+  //! \return Text
+  // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+  std::string_view
+  get_text () const noexcept
+  {
+    return text_;
+  }
+
+  // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+  //! \brief Get width
+  //! \return Width in pixels
+  // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+  int
+  get_width () const noexcept
+  {
+    return width_;
+  }
+
+  // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+  //! \brief Get alignment
+  //! \return Alignment
+  // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+  alignment
+  get_alignment () const noexcept
+  {
+    return alignment_;
+  }
+
+  // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+  //! \brief Get maximum number of lines
+  //! \return Maximum number of lines, or 0 if unlimited
+  // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+  std::size_t
+  get_max_lines () const noexcept
+  {
+    return max_lines_;
+  }
+
+  // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+  //! \brief Get line height
+  //! \return Line height in pixels
+  // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+  int
+  get_line_height () const noexcept
+  {
+    return line_height_;
+  }
+
+private:
+  //! \brief Line break
+  struct line_info
+  {
+    std::size_t offset = 0;             //!< Text offset
+    std::size_t length = 0;             //!< Text length, trailing spaces excluded
+    std::size_t next = 0;               //!< Next line text offset
+    int width = 0;                      //!< Text width, ellipsis excluded
+    bool is_hard_break = false;         //!< Line ends at a newline
+    bool is_ellipsized = false;         //!< Line is followed by an ellipsis
+  };
+
+  int get_advance (std::int32_t, std::int32_t) const;
+  line_info break_line (std::size_t) const;
+  void ellipsize (line_info&) const;
+  void ensure_lines (std::size_t);
+  void invalidate ();
+  int get_line_x (const line_info&) const;
+
+  font font_;                           //!< Font
+  ALLEGRO_FONT *obj_ = nullptr;         //!< Allegro font
+  std::string text_;                    //!< Text
+  int width_ = 0;                       //!< Width in pixels
+  alignment alignment_ = LEFT;          //!< Line alignment
+  std::size_t max_lines_ = 0;           //!< Maximum number of lines, or 0
+  int line_height_ = 0;                 //!< Font line height
+  int ellipsis_width_ = 0;              //!< Ellipsis width
+  std::vector <line_info> lines_;       //!< Lines broken so far
+  std::size_t next_ = 0;                //!< Next line text offset
+  bool is_complete_ = false;            //!< All lines are broken
+};
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Constructor
+//! \param f Font
+//! \param text UTF-8 text
+//! \param width Width in pixels
+//! \param align Line alignment
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+text_layout::impl::impl (const font& f, std::string_view text, int width, alignment align)
+  : text_ (text)
+{
+  set_font (f);
+  set_width (width);
+  set_alignment (align);
+  invalidate ();
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Set font
+//! \param f Font
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+void
+text_layout::impl::set_font (const font& f)
+{
+  ALLEGRO_FONT *obj = f.get_implementation ();
+
+  if (!obj)
+    throw std::invalid_argument ("null font object");
+
+  font_ = f;
+
+  if (obj == obj_)
+    return;
+
+  obj_ = obj;
+  line_height_ = std::max (al_get_font_line_height (obj_), 1);
+  ellipsis_width_ = 0;
+
+  std::int32_t prev = -1;
+
+  for (char c : std::string_view (ELLIPSIS))
+    {
+      if (prev != -1)
+        ellipsis_width_ += get_advance (prev, c);
+
+      prev = c;
+    }
+
+  ellipsis_width_ += get_advance (prev, ALLEGRO_NO_KERNING);
+
+  invalidate ();
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Set text
+//! \param text UTF-8 text
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+void
+text_layout::impl::set_text (std::string_view text)
+{
+  if (text == text_)
+    return;
+
+  text_ = text;
+  invalidate ();
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Append text, keeping line breaks before the last paragraph
+//! \param text UTF-8 text
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+void
+text_layout::impl::append_text (std::string_view text)
+{
+  if (text.empty ())
+    return;
+
+  text_ += text;
+
+  // An ellipsized layout may end anywhere, so it is broken again
+  if (max_lines_)
+    {
+      invalidate ();
+      return;
+    }
+
+  while (!lines_.empty () && !lines_.back ().is_hard_break)
+    lines_.pop_back ();
+
+  next_ = lines_.empty () ? 0 : lines_.back ().next;
+  is_complete_ = false;
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Set width
+//! \param width Width in pixels
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+void
+text_layout::impl::set_width (int width)
+{
+  if (width < 1)
+    throw std::invalid_argument ("invalid text layout width");
+
+  if (width == width_)
+    return;
+
+  width_ = width;
+  invalidate ();
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Set alignment. Line breaks are kept
+//! \param align Line alignment
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+void
+text_layout::impl::set_alignment (alignment align)
+{
+  if (align > JUSTIFY)
+    throw std::invalid_argument ("invalid text layout alignment");
+
+  alignment_ = align;
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Set maximum number of lines
+//! \param max_lines Maximum number of lines, or 0 if unlimited
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+void
+text_layout::impl::set_max_lines (std::size_t max_lines)
+{
+  if (max_lines == max_lines_)
+    return;
+
+  max_lines_ = max_lines;
+  invalidate ();
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Get number of lines, breaking the whole text
+//! \return Number of lines
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+std::size_t
+text_layout::impl::get_line_count ()
+{
+  ensure_lines (std::numeric_limits <std::size_t>::max ());
+
+  return lines_.size ();
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Get line
+//! \param idx Line index
+//! \return Line
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+text_layout::line
+text_layout::impl::get_line (std::size_t idx)
+{
+  ensure_lines (idx + 1);
+
+  if (idx >= lines_.size ())
+    throw std::invalid_argument ("invalid text layout line index");
+
+  const line_info& l = lines_[idx];
+
+  line result;
+  result.text = std::string_view (text_).substr (l.offset, l.length);
+  result.x = get_line_x (l);
+  result.y = int (idx) * line_height_;
+  result.width = l.width + (l.is_ellipsized ? ellipsis_width_ : 0);
+  result.is_ellipsized = l.is_ellipsized;
+
+  return result;
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Draw rows of the layout
+//! \param x Left X pos
+//! \param y Y pos where row <i>top</i> is drawn
+//! \param c Color object
+//! \param top First layout row, in pixels
+//! \param height Number of layout rows, in pixels
+//!
+//! Only lines overlapping rows [top, top + height) are broken and drawn.
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+void
+text_layout::impl::draw (int x, int y, const color& c, int top, int height)
+{
+  if (height <= 0)
+    return;
+
+  const std::size_t first = top > 0 ? std::size_t (top / line_height_) : 0;
+  const long long bottom = (long long) top + height;
+
+  if (bottom <= 0)
+    return;
+
+  const std::size_t last = std::size_t ((bottom + line_height_ - 1) / line_height_);
+  ensure_lines (last);
+
+  const ALLEGRO_COLOR color = c.get_implementation ();
+  const bool is_held = al_is_bitmap_drawing_held ();
+
+  if (!is_held)
+    al_hold_bitmap_drawing (true);
+
+  for (std::size_t i = first; i < std::min (last, lines_.size ()); i++)
+    {
+      const line_info& l = lines_[i];
+      const float line_x = float (x + get_line_x (l));
+      const float line_y = float (y + int (i) * line_height_ - top);
+
+      ALLEGRO_USTR_INFO info;
+      const ALLEGRO_USTR *ustr = al_ref_buffer (&info, text_.data () + l.offset, l.length);
+
+      const bool is_last = is_complete_ && i + 1 == lines_.size ();
+
+      if (alignment_ == JUSTIFY && !l.is_hard_break && !l.is_ellipsized && !is_last)
+        al_draw_justified_ustr (obj_, color, line_x, line_x + float (width_), line_y, float (width_), ALLEGRO_ALIGN_LEFT, ustr);
+
+      else
+        al_draw_ustr (obj_, color, line_x, line_y, ALLEGRO_ALIGN_LEFT, ustr);
+
+      if (l.is_ellipsized)
+        al_draw_text (obj_, color, line_x + float (l.width), line_y, ALLEGRO_ALIGN_LEFT, ELLIPSIS);
+    }
+
+  if (!is_held)
+    al_hold_bitmap_drawing (false);
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Get glyph advance
+//! \param cp Code point
+//! \param next Next code point, or ALLEGRO_NO_KERNING
+//! \return Advance in pixels, kerning included
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+int
+text_layout::impl::get_advance (std::int32_t cp, std::int32_t next) const
+{
+  return al_get_glyph_advance (obj_, cp == '\t' ? ' ' : cp, next == '\t' ? ' ' : next);
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Break one line
+//! \param start Line text offset
+//! \return Line
+//!
+//! Lines break after the last space that fits, or between glyphs when a
+//! word alone is wider than the layout. A line holds at least one glyph.
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+text_layout::impl::line_info
+text_layout::impl::break_line (std::size_t start) const
+{
+  line_info l;
+  l.offset = start;
+
+  std::size_t pos = start;
+  std::size_t content_end = start;      // offset past the last glyph that is not a space
+  int content_width = 0;                // width up to content_end
+  int pen = 0;                          // current glyph X pos
+  std::int32_t prev = -1;
+
+  std::size_t break_end = std::string::npos;    // line end at the last space run
+  std::size_t break_next = 0;                   // next line offset after that run
+  int break_width = 0;
+
+  while (pos < text_.size ())
+    {
+      const std::size_t cp_pos = pos;
+      const std::int32_t cp = decode_utf8 (text_, pos);
+
+      if (cp == '\n')
+        {
+          l.length = content_end - start;
+          l.width = content_width;
+          l.next = pos;
+          l.is_hard_break = true;
+          return l;
+        }
+
+      if (prev != -1)
+        pen += get_advance (prev, cp);
+
+      if (is_space (cp))
+        {
+          if (prev != -1 && !is_space (prev) && content_end > start)
+            {
+              break_end = content_end;
+              break_width = content_width;
+            }
+
+          break_next = pos;
+        }
+
+      else
+        {
+          const int end_width = pen + get_advance (cp, ALLEGRO_NO_KERNING);
+
+          if (end_width > width_ && content_end > start)
+            {
+              if (break_end != std::string::npos)
+                {
+                  l.length = break_end - start;
+                  l.width = break_width;
+                  l.next = break_next;
+                }
+
+              else
+                {
+                  l.length = content_end - start;
+                  l.width = content_width;
+                  l.next = cp_pos;
+                }
+
+              return l;
+            }
+
+          content_end = pos;
+          content_width = end_width;
+        }
+
+      prev = cp;
+    }
+
+  l.length = content_end - start;
+  l.width = content_width;
+  l.next = pos;
+
+  return l;
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Shorten line so that it fits with an ellipsis after it
+//! \param l Line
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+void
+text_layout::impl::ellipsize (line_info& l) const
+{
+  const std::string_view text = std::string_view (text_).substr (0, l.offset + l.length);
+
+  std::size_t pos = l.offset;
+  std::size_t content_end = l.offset;
+  int content_width = 0;
+  int pen = 0;
+  std::int32_t prev = -1;
+
+  while (pos < text.size ())
+    {
+      const std::int32_t cp = decode_utf8 (text, pos);
+
+      if (prev != -1)
+        pen += get_advance (prev, cp);
+
+      if (!is_space (cp))
+        {
+          const int end_width = pen + get_advance (cp, ALLEGRO_NO_KERNING);
+
+          if (end_width + ellipsis_width_ > width_)
+            break;
+
+          content_end = pos;
+          content_width = end_width;
+        }
+
+      prev = cp;
+    }
+
+  l.length = content_end - l.offset;
+  l.width = content_width;
+  l.is_hard_break = false;
+  l.is_ellipsized = true;
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Break lines until there are <i>count</i> lines or the text ends
+//! \param count Number of lines
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+void
+text_layout::impl::ensure_lines (std::size_t count)
+{
+  while (!is_complete_ && lines_.size () < count)
+    {
+      line_info l = break_line (next_);
+
+      if (!l.is_hard_break && l.next >= text_.size ())
+        is_complete_ = true;
+
+      else if (max_lines_ && lines_.size () + 1 == max_lines_)
+        {
+          ellipsize (l);
+          is_complete_ = true;
+        }
+
+      next_ = l.next;
+      lines_.push_back (l);
+    }
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Discard line breaks
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+void
+text_layout::impl::invalidate ()
+{
+  lines_.clear ();
+  next_ = 0;
+  is_complete_ = text_.empty ();
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Get line X pos, relative to the layout
+//! \param l Line
+//! \return X pos
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+int
+text_layout::impl::get_line_x (const line_info& l) const
+{
+  const int w = l.width + (l.is_ellipsized ? ellipsis_width_ : 0);
+
+  switch (alignment_)
+    {
+      case CENTER: return (width_ - w) / 2;
+      case RIGHT: return width_ - w;
+      default: return 0;
+    }
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Constructor
+//! \param f Font
+//! \param width Width in pixels
+//! \param align Line alignment
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+text_layout::text_layout (const font& f, int width, alignment align)
+  : impl_ (std::make_shared <impl> (f, std::string_view (), width, align))
+{
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Constructor
+//! \param f Font
+//! \param text UTF-8 text
+//! \param width Width in pixels
+//! \param align Line alignment
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+text_layout::text_layout (const font& f, std::string_view text, int width, alignment align)
+  : impl_ (std::make_shared <impl> (f, text, width, align))
+{
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Set font, breaking lines again if it changed
+//! \param f Font
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+void
+text_layout::set_font (const font& f)
+{
+  impl_->set_font (f);
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Set text, breaking lines again if it changed
+//! \param text UTF-8 text
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+void
+text_layout::set_text (std::string_view text)
+{
+  impl_->set_text (text);
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Append text, breaking only the last paragraph again
+//! \param text UTF-8 text
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+void
+text_layout::append_text (std::string_view text)
+{
+  impl_->append_text (text);
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Set width, breaking lines again if it changed
+//! \param width Width in pixels
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+void
+text_layout::set_width (int width)
+{
+  impl_->set_width (width);
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Set alignment
+//! \param align Line alignment
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+void
+text_layout::set_alignment (alignment align)
+{
+  impl_->set_alignment (align);
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Set maximum number of lines. The last one ends with an ellipsis
+//! if the text does not fit
+//! \param max_lines Maximum number of lines, or 0 if unlimited
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+void
+text_layout::set_max_lines (std::size_t max_lines)
+{
+  impl_->set_max_lines (max_lines);
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Get font
+//! \return Font
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+font
+text_layout::get_font () const
+{
+  return impl_->get_font ();
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Get text
+//! \return Text, valid until the layout text changes
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+std::string_view
+text_layout::get_text () const
+{
+  return impl_->get_text ();
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Get width
+//! \return Width in pixels
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+int
+text_layout::get_width () const
+{
+  return impl_->get_width ();
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Get alignment
+//! \return Line alignment
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+text_layout::alignment
+text_layout::get_alignment () const
+{
+  return impl_->get_alignment ();
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Get maximum number of lines
+//! \return Maximum number of lines, or 0 if unlimited
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+std::size_t
+text_layout::get_max_lines () const
+{
+  return impl_->get_max_lines ();
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Get line height
+//! \return Line height in pixels
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+int
+text_layout::get_line_height () const
+{
+  return impl_->get_line_height ();
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Get number of lines, breaking the whole text
+//! \return Number of lines
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+std::size_t
+text_layout::get_line_count () const
+{
+  return impl_->get_line_count ();
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Get height, breaking the whole text
+//! \return Height in pixels
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+int
+text_layout::get_height () const
+{
+  return int (impl_->get_line_count ()) * impl_->get_line_height ();
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Get line, breaking lines up to it
+//! \param idx Line index
+//! \return Line, whose text is valid until the layout text changes
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+text_layout::line
+text_layout::get_line (std::size_t idx) const
+{
+  return impl_->get_line (idx);
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Draw all lines
+//! \param x Left X pos
+//! \param y Top Y pos
+//! \param c Color object
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+void
+text_layout::draw (int x, int y, const color& c) const
+{
+  impl_->draw (x, y, c, 0, std::numeric_limits <int>::max ());
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Draw visible rows of the layout (e.g. a scrolled view)
+//! \param x Left X pos
+//! \param y Y pos where row <i>top</i> is drawn
+//! \param c Color object
+//! \param top First visible row, in pixels from the layout top
+//! \param height Visible height, in pixels
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+void
+text_layout::draw (int x, int y, const color& c, int top, int height) const
+{
+  impl_->draw (x, y, c, top, height);
+}
+
+} // namespace allegropp
@@ -0,0 +1,78 @@
+#ifndef ALLEGROPP_UTF8
+#define ALLEGROPP_UTF8
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @author      Eduardo Aguiar <aguiar@protonmail.ch>
+// @copyright   Copyright (c) 2025 Eduardo Aguiar
+//
+// This file is part of Allegro++.
+// 
+// Allegro++ is free software: you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+// 
+// You should have received a copy of the GNU Lesser General Public License
+// along with Allegro++. If not, see <https://www.gnu.org/licenses/>.
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+
+namespace allegropp
+{
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Decode UTF-8 code point
+//! \param s Text
+//! \param pos Code point offset, advanced past it
+//! \return Code point, or U+FFFD for a malformed sequence (one byte skipped)
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+inline std::int32_t
+decode_utf8 (std::string_view s, std::size_t& pos) noexcept
+{
+  const auto c = static_cast <unsigned char> (s[pos]);
+
+  if (c < 0x80)
+    {
+      pos++;
+      return c;
+    }
+
+  std::size_t n = 0;
+
+  if ((c & 0xe0) == 0xc0)
+    n = 1;
+
+  else if ((c & 0xf0) == 0xe0)
+    n = 2;
+
+  else if ((c & 0xf8) == 0xf0)
+    n = 3;
+
+  if (n && pos + n < s.size ())
+    {
+      std::int32_t cp = c & (0x3f >> n);
+      std::size_t i = 1;
+
+      while (i <= n && (static_cast <unsigned char> (s[pos + i]) & 0xc0) == 0x80)
+        cp = (cp << 6) | (static_cast <unsigned char> (s[pos + i++]) & 0x3f);
+
+      if (i > n)
+        {
+          pos += n + 1;
+          return cp;
+        }
+    }
+
+  pos++;
+  return 0xfffd;
+}
+
+} // namespace allegropp
+
+#endif